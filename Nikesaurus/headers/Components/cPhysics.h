@@ -62,6 +62,7 @@ namespace NIKE {
             bool b_collided;
             Resolution resolution;
             float restitution; // Entity-specific restitution (elasticity)
+            bool b_continuous; // Sweep against broadphase for time of impact ( small fast bodies like bullets )
 
             Collider()
                 : shape_type{ ShapeType::AABB },
@@ -70,7 +71,8 @@ namespace NIKE {
                 b_bind_to_entity{ true },
                 b_collided{ false },
                 resolution{ Resolution::NONE },
-                restitution{ 1.0f } {} // Default to perfectly elastic
+                restitution{ 1.0f }, // Default to perfectly elastic
+                b_continuous{ false } {}
         };
 
 
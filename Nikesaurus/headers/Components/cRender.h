@@ -69,7 +69,7 @@ namespace NIKE {
 		};
 
 		struct Text {
-			std::string font_id;
+			Utility::InternedString font_id;
 			std::string text;
 			Vector4f color;
 			float scale;
@@ -83,7 +83,7 @@ namespace NIKE {
 
 		// set use_override_color to true if setting an override_color
 		struct Shape {
-			std::string model_id;
+			Utility::InternedString model_id;
 			Vector2f pos;
 
 			Vector4f color;
@@ -97,7 +97,7 @@ namespace NIKE {
 		};
 
 		struct Texture {
-			std::string texture_id;
+			Utility::InternedString texture_id;
 			Vector4f color;
 			Vector2i frame_size;	// x: 1 / frames in col,  y: 1 / frames in row
 			Vector2i frame_index;	// frame 1: (0,0), frame 2: (1,0) ( topleft to bot right )
@@ -303,6 +303,27 @@ namespace NIKE {
 
         //Max number of entities to be created at a single point
         const Type MAX = 3000;
+
+        //Generation of an entity slot ( incremented each time the slot is freed )
+        using Generation = uint16_t;
+
+        //Generational entity handle ( generation in high 16 bits, entity in low 16 bits )
+        using Handle = uint32_t;
+
+        //Pack entity & generation into a handle
+        inline Handle makeHandle(Type entity, Generation generation) {
+            return (static_cast<Handle>(generation) << 16) | static_cast<Handle>(entity);
+        }
+
+        //Get entity of handle
+        inline Type getHandleEntity(Handle handle) {
+            return static_cast<Type>(handle & 0xFFFF);
+        }
+
+        //Get generation of handle
+        inline Generation getHandleGeneration(Handle handle) {
+            return static_cast<Generation>(handle >> 16);
+        }
     }
 
     namespace Component {
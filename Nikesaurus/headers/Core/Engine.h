@@ -27,6 +27,7 @@
 #include "Managers/Services/Lua/sLua.h"
 #include "Managers/Services/LevelEditor/sLevelEditor.h"
 #include "Managers/Services/sPath.h"
+#include "Managers/Services/sJobs.h"
 #include "Managers/Services/sMetaData.h"
 #include "Managers/Services/State Machine/sStateMachine.h"
 
@@ -162,6 +163,7 @@ namespace NIKE {
 #define NIKE_PATH_SERVICE NIKE::Core::Engine::getInstance().getService<NIKE::Path::Service>()
 #define NIKE_METADATA_SERVICE NIKE::Core::Engine::getInstance().getService<NIKE::MetaData::Service>()
 #define NIKE_FSM_SERVICE NIKE::Core::Engine::getInstance().getService<NIKE::StateMachine::Service>()
+#define NIKE_JOBS_SERVICE NIKE::Core::Engine::getInstance().getService<NIKE::Jobs::Service>()
 
 //ECS manager for internal usage
 #ifdef NIKE_BUILD_DLL
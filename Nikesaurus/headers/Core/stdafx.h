@@ -82,8 +82,10 @@
 #include <fstream>
 #include <algorithm>
 #include <vector>
+#include <deque>
 #include <array>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <cctype>
 #include <sstream>
@@ -100,6 +102,9 @@
 #include <iomanip>
 #include <chrono>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
 #include <optional>
 #include <stack>
 #include <regex>
@@ -126,9 +131,13 @@ using namespace NIKE::Math;
 /*****************************************************************//**
 * Utility
 *********************************************************************/
+#include "Utility/uStringID.h"
 #include "Utility/uSystems.h"
 #include "Utility/uLogger.h"
 
+//Using string id literals
+using namespace NIKE::Utility::Literals;
+
 /*****************************************************************//**
 * Math Defines
 *********************************************************************/
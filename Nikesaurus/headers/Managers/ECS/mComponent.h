@@ -15,6 +15,24 @@
 namespace NIKE {
 	namespace Component {
 
+		//Contiguous view over densely packed data ( C++17 stand-in for std::span )
+		template<typename T>
+		class Span {
+		private:
+			T* ptr;
+			size_t count;
+		public:
+			Span() : ptr{ nullptr }, count{ 0 } {}
+			Span(T* ptr, size_t count) : ptr{ ptr }, count{ count } {}
+
+			T* begin() const { return ptr; }
+			T* end() const { return ptr + count; }
+			T* data() const { return ptr; }
+			size_t size() const { return count; }
+			bool empty() const { return count == 0; }
+			T& operator[](size_t index) const { return ptr[index]; }
+		};
+
 		//Component Array interface
 		class IArray {
 		private:
@@ -50,112 +68,177 @@ namespace NIKE {
 
 			// Remove component
 			virtual void removeComponent(Entity::Type entity) = 0;
+
+			//Get packed entities with current comp
+			virtual Span<const Entity::Type> entitySpan() const = 0;
 		};
 
-		//Component Array ( Entity Map of unique components of type T )
+		//Component Array ( Sparse set of unique components of type T )
+		//
+		//Components are packed in a deque, so adding components never moves existing ones.
+		//Removal swaps the last packed component into the freed slot, so a reference to the
+		//last component of T is invalidated by removing any other component of T.
+		//Destruction through MetaData::Service::destroyEntity is deferred to MetaData::Service::update,
+		//after all systems have run, so systems may hold component references within their update.
+		//Direct Coordinator::Manager destroyEntity, destroyAllEntities & removeEntityComponent calls
+		//( scene changes, level editor, UI::Service::destroyButton, lua KillAllEntities ) must not
+		//run while component references are held.
 		template<typename T>
 		class Array : public IArray {
 		private:
 
-			//Unique component of same type identified by Entity type
-			std::unordered_map<Entity::Type, T> component_array;
+			//Sentinel for entities without this component
+			static constexpr Entity::Type INVALID_INDEX = Entity::MAX;
+
+			//Densely packed components of same type ( Deque keeps references valid as it grows )
+			std::deque<T> components;
+
+			//Owning entity of each packed component ( parallel to components )
+			std::vector<Entity::Type> dense_entities;
+
+			//Entity to packed index lookup
+			std::vector<Entity::Type> sparse_indices;
+
+			//Emplace component at the back of the packed arrays
+			template<typename... Args>
+			void emplaceComponent(Entity::Type entity, Args&&... args) {
+				sparse_indices[entity] = static_cast<Entity::Type>(components.size());
+				components.emplace_back(std::forward<Args>(args)...);
+				dense_entities.push_back(entity);
+			}
 		public:
 			//Default constructor
-			Array() = default;
+			Array() : sparse_indices(Entity::MAX, INVALID_INDEX) {}
 
 			//Add new component
 			void addComponent(Entity::Type entity, T&& component) {
 				//Check if entity has already been added
-				if (component_array.find(entity) != component_array.end()) {
+				if (checkEntity(entity)) {
 					throw std::runtime_error("Entity has already been added for this component.");
 				}
 
 				//Emplace component and entity
-				component_array.emplace(std::piecewise_construct, std::forward_as_tuple(entity), std::forward_as_tuple(std::move(component)));
+				emplaceComponent(entity, std::move(component));
 			}
 
 			//Remove existing component
 			void removeComponent(Entity::Type entity) override {
 				//Check if entity is present within components to delete
-				if (component_array.find(entity) == component_array.end()) {
+				if (!checkEntity(entity)) {
 					throw std::runtime_error("Entity not found. Unable to remove.");
 				}
 
-				//Remove entitys
-				component_array.erase(entity);
+				//Swap removed component with last packed component ( References to the last component are invalidated )
+				Entity::Type index = sparse_indices[entity];
+				Entity::Type last = static_cast<Entity::Type>(components.size() - 1);
+				if (index != last) {
+					components[index] = std::move(components[last]);
+					dense_entities[index] = dense_entities[last];
+					sparse_indices[dense_entities[index]] = index;
+				}
+
+				//Pop back
+				components.pop_back();
+				dense_entities.pop_back();
+				sparse_indices[entity] = INVALID_INDEX;
 			}
 
 			//Get entity component data
 			std::optional<std::reference_wrapper<T>> getComponent(Entity::Type entity) {
 				//Check if entity is present within components
-				if (component_array.find(entity) == component_array.end()) {
+				if (!checkEntity(entity)) {
 					return std::nullopt;
 				}
 
 				//Return component array
-				return std::ref(component_array.at(entity));
+				return std::ref(components[sparse_indices[entity]]);
+			}
+
+			//Get entity component data without presence check
+			T& getComponentUnchecked(Entity::Type entity) {
+				return components[sparse_indices[entity]];
+			}
+
+			//Get contiguous view of entities ( packed order )
+			Span<const Entity::Type> entitySpan() const override {
+				return Span<const Entity::Type>(dense_entities.data(), dense_entities.size());
 			}
 
 			//Check entity component
 			bool checkEntity(Entity::Type entity) override {
-				return component_array.find(entity) != component_array.end();
+				return entity < Entity::MAX && sparse_indices[entity] != INVALID_INDEX;
 			}
 
 			size_t getComponentEntitiesCount() override {
-				return component_array.size();
+				return components.size();
 			}
 
 			//Get all entities with current component
 			std::set<Entity::Type> getComponentEntities() override {
-				std::set<Entity::Type> entities_set;
-				for (const auto& entity_comp : component_array) {
-					entities_set.insert(entity_comp.first);
-				}
-				return entities_set;
+				return std::set<Entity::Type>(dense_entities.begin(), dense_entities.end());
 			}
 
 			//get entity component
 			std::shared_ptr<void> getEntityComponent(Entity::Type entity) override {
-				T* raw_ptr = &component_array.at(entity);
+				if (!checkEntity(entity)) {
+					throw std::out_of_range("Entity not found for this component.");
+				}
+
+				T* raw_ptr = &components[sparse_indices[entity]];
 				return std::shared_ptr<void>(raw_ptr, [](void*){});
 			}
 
 			//Get copied entity component
 			std::shared_ptr<void> getCopiedEntityComponent(Entity::Type entity) override {
-				T copy = component_array.at(entity);
+				if (!checkEntity(entity)) {
+					throw std::out_of_range("Entity not found for this component.");
+				}
+
+				T copy = components[sparse_indices[entity]];
 				return std::make_shared<T>(copy);
 			}
 
 			//Set entity
 			void setEntityComponent(Entity::Type entity, std::shared_ptr<void> comp) override {
-				component_array[entity] = *std::static_pointer_cast<T>(comp);
+				if (checkEntity(entity)) {
+					components[sparse_indices[entity]] = *std::static_pointer_cast<T>(comp);
+				}
+				else {
+					emplaceComponent(entity, *std::static_pointer_cast<T>(comp));
+				}
 			}
 
 			//Clone entity
 			void cloneEntity(Entity::Type clone, Entity::Type copy) override {
 				//Clone entity
-				if (component_array.find(copy) != component_array.end()) {
-					T temp_copy = component_array.at(copy);
+				if (checkEntity(copy) && !checkEntity(clone)) {
+					T temp_copy = components[sparse_indices[copy]];
 
 					//Emplace component and entity
-					component_array.emplace(std::piecewise_construct, std::forward_as_tuple(clone), std::forward_as_tuple(std::move(temp_copy)));
+					emplaceComponent(clone, std::move(temp_copy));
 				}
 			}
 
 			//Create default entity component
 			void createDefEntityComponent(Entity::Type entity) override {
-				if (component_array.find(entity) == component_array.end()) {
-					component_array.emplace(std::piecewise_construct, std::forward_as_tuple(entity), std::forward_as_tuple());
+				if (!checkEntity(entity)) {
+					emplaceComponent(entity);
 				}
 			}
 
 			//Remove destroyed entity
 			void entityDestroyed(Entity::Type entity) override {
-				if (component_array.find(entity) != component_array.end())
+				if (checkEntity(entity))
 					removeComponent(entity);
 			}
 		};
 
+		//Per type component family ID ( assigned on registration, MAX when unregistered )
+		template<typename T>
+		struct Family {
+			static inline Component::Type id = Component::MAX;
+		};
+
 		//Manager of the component Array
 		class Manager {
 		private:
@@ -164,20 +247,24 @@ namespace NIKE {
 			Manager(Manager const& copy) = delete;
 			void operator=(Manager const& copy) = delete;
 
-			//Map to component type ( used for signature setting )
+			//Map to component type ( used for serialization & string lookups )
 			std::unordered_map<std::string, Component::Type> component_types;
 
-			//Map to array of component type
-			std::unordered_map<std::string, std::shared_ptr<IArray>> component_arrays;
+			//Component type names indexed by component type
+			std::array<std::string, Component::MAX> component_names;
+
+			//Array of component arrays indexed by component type
+			std::array<std::unique_ptr<IArray>, Component::MAX> component_arrays;
 
 			//Private type casting for easy retrieval
 			template<typename T>
-			std::shared_ptr<Array<T>> getComponentArray() {
-				std::string type_name{ Utility::convertTypeString(typeid(T).name()) };
-
-				return std::static_pointer_cast<Array<T>>(component_arrays.at(type_name));
+			Array<T>* getComponentArray() {
+				return static_cast<Array<T>*>(getIArray(getComponentType<T>()));
 			}
 
+			//Retrieve registered component array by component type
+			IArray* getIArray(Component::Type type) const;
+
 			//Component id
 			Component::Type component_id;
 
@@ -186,40 +273,52 @@ namespace NIKE {
 			//Default Constructor
 			Manager() : component_id{ 0 }{}
 
+			//Retrieve typed component array ( valid until component is removed from manager )
+			template<typename T>
+			Array<T>* getArray() {
+				return getComponentArray<T>();
+			}
+
 			//Register component with manager
 			template<typename T>
 			void registerComponent() {
 
-				//Component type name
-				std::string type_name{ Utility::convertTypeString(typeid(T).name()) };
-
 				//Check if component has been registered before
-				if (component_types.find(type_name) != component_types.end()) {
+				if (Family<T>::id != Component::MAX) {
 					throw std::runtime_error("Component already registered. Register failed.");
 				}
 
+				//Check if component limit has been reached
+				if (component_id >= Component::MAX) {
+					throw std::runtime_error("Too many components registered. Register failed.");
+				}
+
+				//Component type name ( used for serialization only )
+				std::string type_name{ Utility::convertTypeString(typeid(T).name()) };
+
 				//Add component type
-				component_types.emplace(std::piecewise_construct, std::forward_as_tuple(type_name), std::forward_as_tuple(component_id++));
+				Family<T>::id = component_id++;
+				component_types.emplace(type_name, Family<T>::id);
+				component_names[Family<T>::id] = type_name;
 
-				//Add component map
-				component_arrays.emplace(std::piecewise_construct, std::forward_as_tuple(type_name), std::forward_as_tuple(std::move(std::make_shared<Array<T>>())));
+				//Add component array
+				component_arrays[Family<T>::id] = std::make_unique<Array<T>>();
 			}
 
 			template<typename T>
 			void removeComponent() {
-				//Component type name
-				std::string type_name{ Utility::convertTypeString(typeid(T).name()) };
-
 				//Check if component has been registered before
-				if (component_types.find(type_name) == component_types.end()) {
+				if (Family<T>::id == Component::MAX) {
 					throw std::runtime_error("Component has not been registered before. Deregister failed.");
 				}
 
 				//Remove component type
-				component_types.erase(type_name);
+				component_types.erase(component_names[Family<T>::id]);
+				component_names[Family<T>::id].clear();
 
 				//Remove component array
-				component_arrays.erase(type_name);
+				component_arrays[Family<T>::id].reset();
+				Family<T>::id = Component::MAX;
 			}
 
 			//Add component associated with entity type
@@ -236,9 +335,6 @@ namespace NIKE {
 			//Remove component associated with entity type
 			template<typename T>
 			void removeEntityComponent(Entity::Type entity) {
-				//Component type name
-				std::string type_name{ Utility::convertTypeString(typeid(T).name()) };
-
 				//Remove component
 				getComponentArray<T>()->removeComponent(entity);
 			}
@@ -251,6 +347,12 @@ namespace NIKE {
 				return getComponentArray<T>()->getComponent(entity);
 			}
 
+			//Retrieve contiguous view of entities owning components of type T ( packed order )
+			template<typename T>
+			Span<const Entity::Type> getComponentEntitySpan() {
+				return getComponentArray<T>()->entitySpan();
+			}
+
 			//Retrieve a void* to component based on component type
 			std::shared_ptr<void> getEntityComponent(Entity::Type entity, Component::Type type);
 
@@ -262,17 +364,14 @@ namespace NIKE {
 
 			//Get Component Type
 			template<typename T>
-			Component::Type getComponentType() {
-				//Component type name
-				std::string type_name{ Utility::convertTypeString(typeid(T).name()) };
-
+			Component::Type getComponentType() const {
 				//Check if component has been registered
-				if (component_types.find(type_name) == component_types.end()) {
+				if (Family<T>::id == Component::MAX) {
 					throw std::runtime_error("Component not yet registered.");
 				}
 
 				//Return component type
-				return component_types.at(type_name);
+				return Family<T>::id;
 			}
 
 			//Get Component Type string overload
@@ -20,20 +20,149 @@
 namespace NIKE {
 	namespace Coordinator {
 
+		//Delta of entities created & destroyed since the last dispatch
 		struct EntitiesChanged : Events::IEvent {
-			std::set<Entity::Type> entities;
+			std::vector<Entity::Type> added;
+			std::vector<Entity::Type> removed;
 			EntitiesChanged() = default;
-			EntitiesChanged(std::set<Entity::Type> entities) : entities{ entities }{}
+			EntitiesChanged(std::vector<Entity::Type> added, std::vector<Entity::Type> removed) : added{ std::move(added) }, removed{ std::move(removed) }{}
 		};
 
+		//Typed view over entities owning every component in Ts
+		template<typename... Ts>
+		class View {
+		private:
+			static_assert(sizeof...(Ts) > 0, "View requires at least one component type.");
+
+			//Typed component arrays
+			std::tuple<Component::Array<Ts>*...> arrays;
+
+			//Smallest array driving the iteration
+			Component::IArray* driver;
+
+		public:
+
+			//Entity with references to its components
+			using Entry = std::tuple<Entity::Type, Ts&...>;
+
+			//Iterates the driving array backwards, so removing the current entity while iterating is safe
+			class Iterator {
+			private:
+				View const* view;
+				size_t index;
+
+				//Skip entities missing any of the viewed components
+				void skip() {
+					while (index > 0) {
+						auto entities = view->driver->entitySpan();
+						index = Utility::getMin(index, entities.size());
+						if (index == 0 || view->contains(entities[index - 1])) break;
+						--index;
+					}
+				}
+
+			public:
+				Iterator(View const* view, size_t index) : view{ view }, index{ index } { skip(); }
+
+				Entry operator*() const {
+					Entity::Type entity = view->driver->entitySpan()[index - 1];
+					return std::tuple_cat(std::make_tuple(entity), view->get(entity));
+				}
+
+				Iterator& operator++() {
+					--index;
+					skip();
+					return *this;
+				}
+
+				bool operator!=(Iterator const& other) const {
+					return index != other.index;
+				}
+			};
+
+			View(Component::Array<Ts>*... arrays)
+				: arrays{ arrays... }, driver{ nullptr }
+			{
+				//Drive iteration from the smallest pool
+				size_t min_count = std::numeric_limits<size_t>::max();
+				auto pick = [&](Component::IArray* array) {
+					if (array->getComponentEntitiesCount() < min_count) {
+						min_count = array->getComponentEntitiesCount();
+						driver = array;
+					}
+					};
+				(pick(arrays), ...);
+			}
+
+			//Check if entity owns every viewed component
+			bool contains(Entity::Type entity) const {
+				return (std::get<Component::Array<Ts>*>(arrays)->checkEntity(entity) && ...);
+			}
+
+			//Get component references of entity ( entity must be contained )
+			std::tuple<Ts&...> get(Entity::Type entity) const {
+				return std::tuple<Ts&...>(std::get<Component::Array<Ts>*>(arrays)->getComponentUnchecked(entity)...);
+			}
+
+			//Get single component pointer of entity, nullptr if absent
+			template<typename T>
+			T* tryGet(Entity::Type entity) const {
+				auto* array = std::get<Component::Array<T>*>(arrays);
+				return array->checkEntity(entity) ? &array->getComponentUnchecked(entity) : nullptr;
+			}
+
+			//Upper bound of entities iterated
+			size_t sizeHint() const {
+				return driver->getComponentEntitiesCount();
+			}
+
+			Iterator begin() const {
+				return Iterator(this, driver->entitySpan().size());
+			}
+
+			Iterator end() const {
+				return Iterator(this, 0);
+			}
+
+			//Invoke func( entity, Ts&... ) for every matching entity
+			template<typename Func>
+			void each(Func&& func) const {
+				for (auto entry : *this) {
+					std::apply(func, entry);
+				}
+			}
+		};
+
+		//Forward declaration of batch guard
+		class BatchGuard;
+
 		class Manager {
 		private:
+			//Batch guard begins & ends batches
+			friend class BatchGuard;
+
 			//ECS Managers
 			std::unique_ptr<Entity::Manager> entity_manager;
 			std::unique_ptr<Component::Manager> component_manager;
 			std::unique_ptr<System::Manager> system_manager;
 			static int nextEntityId;
 
+			//Nested batch depth ( EntitiesChanged is dispatched when it returns to 0 )
+			int batch_depth;
+
+			//Entities created & destroyed within the current batch
+			std::set<Entity::Type> pending_added;
+			std::set<Entity::Type> pending_removed;
+
+			//Dispatch coalesced EntitiesChanged delta
+			void dispatchEntitiesChanged();
+
+			//Begin batching entity lifecycle changes ( batches may be nested )
+			void beginBatch();
+
+			//End batch, dispatching one EntitiesChanged delta when the outermost batch ends
+			void endBatch();
+
 		public:
 
 			//Default constructor
@@ -48,18 +177,30 @@ namespace NIKE {
 			//Clone entity ( ID of clone returned )
 			Entity::Type cloneEntity(Entity::Type copy);
 
-			//Destroy Entity
+			//Destroy Entity ( Immediate, may move other components, see Component::Array )
 			void destroyEntity(Entity::Type entity);
 
 			//Check entity
 			bool checkEntity(Entity::Type entity) const;
 
+			//Get generational handle of entity
+			Entity::Handle getEntityHandle(Entity::Type entity) const;
+
+			//Check handle still refers to the same live entity
+			bool checkEntityHandle(Entity::Handle handle) const;
+
 			//Get entity component count
 			int getEntityComponentCount(Entity::Type entity) const;
 
-			//Destroy Entity
+			//Destroy all entities ( Immediate, see Component::Array )
 			void destroyAllEntities();
 
+			//Destroy entities with a single EntitiesChanged dispatch
+			void destroyEntities(std::vector<Entity::Type> const& entities);
+
+			//Batch entity lifecycle changes until the returned guard goes out of scope
+			[[nodiscard]] BatchGuard batchEntityChanges();
+
 			//Get entity count
 			int getEntitiesCount();
 
@@ -129,12 +270,33 @@ namespace NIKE {
 				return component_manager->getEntityComponent<T>(entity);
 			}
 
+			template<typename T>
+			Component::Span<const Entity::Type> getComponentEntitySpan() {
+				return component_manager->getComponentEntitySpan<T>();
+			}
+
+			//View of entities owning every component in Ts
+			template<typename... Ts>
+			View<Ts...> view() {
+				return View<Ts...>(component_manager->getArray<Ts>()...);
+			}
+
 			std::shared_ptr<void> getEntityComponent(Entity::Type entity, Component::Type type);
 
 			std::shared_ptr<void> getCopiedEntityComponent(Entity::Type entity, Component::Type type);
 
 			void setEntityComponent(Entity::Type entity, Component::Type type, std::shared_ptr<void> comp);
 
+			//Get component pointer through entity signature, nullptr if absent
+			template<typename T>
+			T* tryGetEntityComponent(Entity::Type entity) {
+				if (!entity_manager->getSignature(entity).test(component_manager->getComponentType<T>())) {
+					return nullptr;
+				}
+
+				return &component_manager->getArray<T>()->getComponentUnchecked(entity);
+			}
+
 			template<typename T>
 			bool checkEntityComponent(Entity::Type entity) {
 				return entity_manager->getSignature(entity).test(component_manager->getComponentType<T>());
@@ -209,6 +371,19 @@ namespace NIKE {
 
 			std::vector<std::shared_ptr<System::ISystem>>& getAllSystems();
 		};
+
+		//Batches entity lifecycle changes for its lifetime ( Batch ends even when an exception leaves the scope )
+		class BatchGuard {
+		private:
+			Manager& manager;
+
+			//Delete Copy Constructor & Copy Assignment
+			BatchGuard(BatchGuard const& copy) = delete;
+			void operator=(BatchGuard const& copy) = delete;
+		public:
+			explicit BatchGuard(Manager& manager);
+			~BatchGuard();
+		};
 	}
 }
 
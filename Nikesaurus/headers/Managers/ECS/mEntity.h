@@ -22,11 +22,22 @@ namespace NIKE {
 			Manager(Manager const& copy) = delete;
 			void operator=(Manager const& copy) = delete;
 
-			//Map of create entities and their component signatures
-			std::unordered_map<Entity::Type, Component::Signature> entities;
+			//Component signatures indexed by entity
+			std::vector<Component::Signature> signatures;
 
-			//Entity indexes waiting to be used
-			std::queue<Entity::Type> avail_entities;
+			//Generation of each entity slot
+			std::vector<Entity::Generation> generations;
+
+			//Alive flag of each entity slot
+			std::vector<uint8_t> alive;
+
+			//Packed FIFO ring of entity indexes waiting to be used
+			std::vector<Entity::Type> avail_entities;
+			size_t avail_head;
+			size_t avail_count;
+
+			//Number of active entities
+			int entities_count;
 
 		public:
 
@@ -42,6 +53,12 @@ namespace NIKE {
 			//Check entity is present
 			bool checkEntity(Entity::Type entity) const;
 
+			//Get generational handle of entity
+			Entity::Handle getHandle(Entity::Type entity) const;
+
+			//Check handle still refers to the same live entity
+			bool checkHandle(Entity::Handle handle) const;
+
 			//Set signature
 			void setSignature(Entity::Type entity, Component::Signature signature);
 
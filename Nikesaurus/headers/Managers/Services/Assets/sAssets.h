@@ -89,6 +89,9 @@ namespace NIKE {
 			//Assets cache for storing assets ( Optionally change to weakptr for a more event driven approach )
 			std::unordered_map<std::string, std::shared_ptr<void>> asset_cache;
 
+			//Assets cache keyed by interned handle ( Skips string hashing for per frame lookups )
+			std::unordered_map<Utility::StringID, std::shared_ptr<void>> handle_cache;
+
 			//Font loader
 			std::unique_ptr<Assets::FontLoader> font_loader;
 
@@ -127,6 +130,9 @@ namespace NIKE {
 			//Recache asset
 			void recacheAsset(std::string const& asset_id);
 
+			//Get runtime texture atlas ( GL_TEXTURE_2D_ARRAY, 0 if empty )
+			unsigned int getTextureAtlas() const;
+
 			//Get asset
 			template <typename T>
 			std::shared_ptr<T> getAsset(std::string const& asset_id) {
@@ -170,6 +176,31 @@ namespace NIKE {
 				return std::static_pointer_cast<T>(asset);
 			}
 
+			//Get asset from interned handle
+			template <typename T>
+			std::shared_ptr<T> getAsset(Utility::StringID asset_handle) {
+
+				//Check handle cache
+				auto handle_it = handle_cache.find(asset_handle);
+				if (handle_it != handle_cache.end()) {
+					return std::static_pointer_cast<T>(handle_it->second);
+				}
+
+				//Registered asset ids are interned on registration
+				if (!Utility::isStringInterned(asset_handle)) {
+					return nullptr;
+				}
+
+				//Resolve through asset id
+				auto asset = getAsset<T>(Utility::getInternedString(asset_handle));
+				if (asset) {
+					handle_cache.emplace(asset_handle, asset);
+				}
+
+				//Return asset
+				return asset;
+			}
+
 			//Get executable
 			void getExecutable(std::string const& asset_id);
 
@@ -221,6 +252,9 @@ namespace NIKE {
 			//Check for registration
 			bool isAssetRegistered(std::string const& asset_id) const;
 
+			//Check for registration from interned handle
+			bool isAssetRegistered(Utility::StringID asset_handle) const;
+
 			//Get ref from path
 			std::string getIDFromPath(std::string const& path, bool b_virtual = true) const;
 
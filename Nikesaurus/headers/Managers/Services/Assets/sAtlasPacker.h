@@ -0,0 +1,88 @@
+/*****************************************************************//**
+ * \file   sAtlasPacker.h
+ * \brief  Skyline rect packer for runtime texture atlases
+ *
+ * \author agent, agent@local (100%)
+ * \date   October 2026
+ * All content © 2026 DigiPen Institute of Technology Singapore, all rights reserved.
+ *********************************************************************/
+
+#pragma once
+
+#ifndef ATLAS_PACKER_HPP
+#define ATLAS_PACKER_HPP
+
+namespace NIKE {
+	namespace Assets {
+
+		//Temporary Disable DLL Export Warning
+		#pragma warning(disable: 4251)
+
+		//Packed region within atlas layer ( Position and size exclude padding )
+		struct AtlasRegion {
+			int layer;
+			Vector2i pos;
+			Vector2i size;
+
+			AtlasRegion() : layer{ -1 }, pos{}, size{} {}
+		};
+
+		/*****************************************************************//**
+		* Atlas packer ( CPU only, no GL calls )
+		*********************************************************************/
+		class NIKE_API AtlasPacker {
+		private:
+			//Top edge segment of packed area in a layer
+			struct SkylineNode {
+				int x;
+				int y;
+				int width;
+			};
+
+			//Layer dimensions
+			Vector2i layer_size;
+
+			//Max layers that can be opened
+			int max_layers;
+
+			//Border around each rect ( Filled with extruded edge texels to stop filtering bleed )
+			int padding;
+
+			//Skyline per opened layer
+			std::vector<std::vector<SkylineNode>> skylines;
+
+			//Get y position a rect fits at when placed on node ( -1 if it does not fit )
+			int fitSkyline(std::vector<SkylineNode> const& skyline, size_t index, int width, int height) const;
+
+			//Raise skyline after placing a rect
+			void addSkylineLevel(std::vector<SkylineNode>& skyline, size_t index, int x, int y, int width, int height);
+
+		public:
+			AtlasPacker(Vector2i const& layer_size, int max_layers, int padding = 1);
+			~AtlasPacker() = default;
+
+			//Pack rect of size ( Returns false if no layer has space )
+			bool pack(Vector2i const& size, AtlasRegion& region);
+
+			//Clear all layers
+			void reset();
+
+			//Get number of layers in use
+			int getLayerCount() const;
+
+			//Get layer dimensions
+			Vector2i getLayerSize() const;
+
+			//Get padding
+			int getPadding() const;
+
+			//Copy RGBA8 image into buffer with padding filled by clamped edge texels
+			static std::vector<unsigned char> extrudeImage(const unsigned char* rgba, Vector2i const& size, int padding);
+		};
+
+		//Re-enable DLL Export warning
+		#pragma warning(default: 4251)
+	}
+}
+
+#endif //!ATLAS_PACKER_HPP
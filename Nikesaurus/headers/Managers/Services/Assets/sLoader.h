@@ -12,6 +12,8 @@
 #ifndef LOADER_HPP
 #define LOADER_HPP
 
+#include "Managers/Services/Assets/sAtlasPacker.h"
+
 namespace NIKE {
 	namespace Assets {
 
@@ -116,9 +118,14 @@ namespace NIKE {
 			Vector2i size;
 			std::string file_path;
 
-			Texture() : gl_data{ 0 }, size{}, file_path{ "" } {}
+			//Atlas placement ( Layer is -1 when texture is not in the atlas )
+			int atlas_layer;
+			Vector2f atlas_uv_offset;
+			Vector2f atlas_uv_scale;
+
+			Texture() : gl_data{ 0 }, size{}, file_path{ "" }, atlas_layer{ -1 }, atlas_uv_offset{}, atlas_uv_scale{ 1.0f, 1.0f } {}
 			Texture(unsigned int gl_data, Vector2i size, std::string file_path)
-				: gl_data{ gl_data }, size{ std::move(size) }, file_path{ std::move(file_path) } {}
+				: gl_data{ gl_data }, size{ std::move(size) }, file_path{ std::move(file_path) }, atlas_layer{ -1 }, atlas_uv_offset{}, atlas_uv_scale{ 1.0f, 1.0f } {}
 		};
 
 		//Shader/Model/Texture Loader
@@ -134,7 +141,14 @@ namespace NIKE {
 			void createBaseBuffers(const std::vector<Vector2f>& vertices, const std::vector<unsigned int>& indices, Model& model);
 
 
-			void createBatchedBaseBuffers(Model& model);
+			/**
+			 * creates a vertex array object with a static quad for batched rendering.
+			 * per instance attributes are read from the render service instance ring.
+			 *
+			 * \param model		vao will be stored here
+			 * \param indices
+			 */
+			void createBatchedBaseBuffers(Model& model, const std::vector<unsigned int>& indices);
 
 			/**
 			 * creates a vertex array object for base opengl shaders.
@@ -145,13 +159,43 @@ namespace NIKE {
 			 */
 			void createTextureBuffers(const std::vector<Vector2f>& vertices, const std::vector<unsigned int>& indices, const std::vector<Vector2f>& tex_coords, Model& model);
 
-			void createBatchedTextureBuffers(Model& model);
+			/**
+			 * creates a vertex array object with a static textured quad for batched rendering.
+			 * per instance attributes are read from the render service instance ring.
+			 *
+			 * \param model		vao will be stored here
+			 * \param indices
+			 */
+			void createBatchedTextureBuffers(Model& model, const std::vector<unsigned int>& indices);
+
+			//Runtime texture atlas ( GL_TEXTURE_2D_ARRAY, layers packed by atlas_packer )
+			static constexpr int ATLAS_LAYER_SIZE = 2048;
+			static constexpr int ATLAS_MAX_LAYERS = 4;
+			static constexpr int ATLAS_MAX_ENTRY_SIZE = 1024;
+			static constexpr int ATLAS_PADDING = 1;
+
+			AtlasPacker atlas_packer;
+			unsigned int atlas_texture;
+
+			/**
+			 * copies RGBA8 image into the texture atlas and stores its layer and uv rect in texture.
+			 * textures larger than ATLAS_MAX_ENTRY_SIZE or that no longer fit are left out of the atlas.
+			 *
+			 * \param tex_data
+			 * \param texture
+			 */
+			void addToTextureAtlas(const unsigned char* tex_data, Texture& texture);
 
 
 		public:
-			RenderLoader() = default;
+			RenderLoader() : atlas_packer{ { ATLAS_LAYER_SIZE, ATLAS_LAYER_SIZE }, ATLAS_MAX_LAYERS, ATLAS_PADDING }, atlas_texture{ 0 } {}
 			~RenderLoader() = default;
 
+			/**
+			 * texture atlas array handle, 0 if no texture has been packed yet.
+			 */
+			unsigned int getTextureAtlas() const;
+
 
 			/**
 			 * all .tex files should be 256x256 in RGBA8 format.
@@ -11,6 +11,8 @@
 #ifndef S_LUA_HPP
 #define S_LUA_HPP
 
+#include "Managers/ECS/mCoordinator.h"
+
 namespace NIKE {
 	namespace Lua {
 
@@ -22,7 +24,7 @@ namespace NIKE {
 
 		//Lua script component
 		struct NIKE_API Script {
-			std::string script_id;
+			Utility::InternedString script_id;
 
 			std::string start_function;
 			std::string update_function;
@@ -47,23 +49,58 @@ namespace NIKE {
 		};
 
 		//Lua Service
-		class NIKE_API Service {
+		class NIKE_API Service : public Events::IEventListener<Coordinator::EntitiesChanged> {
 		private:
 
-			//Lua State
+			//Module returned from executing a script chunk once
+			struct ScriptModule {
+				//Returned table or function
+				sol::object object;
+
+				//Resolved functions of module table
+				std::unordered_map<std::string, sol::protected_function> functions;
+			};
+
+			//Argument table reused across calls
+			struct ScriptArgs {
+				sol::table table;
+
+				//Named args last written into table
+				std::unordered_map<std::string, LuaValue> values;
+			};
+
+			//Lua State ( Declared first, outlives cached lua references )
 			std::unique_ptr<sol::state> lua_state;
 
 			//List of global functions to use in lua
 			std::unordered_set<std::string> lua_global_funcs;
 
+			//Cached modules per script id
+			std::unordered_map<Utility::StringID, ScriptModule> script_modules;
+
+			//Cached argument tables per entity & script id
+			std::unordered_map<Entity::Type, std::unordered_map<Utility::StringID, ScriptArgs>> script_args;
+
+			//Get module of script, executing chunk only when not cached
+			ScriptModule& getScriptModule(Utility::StringID script_handle);
+
+			//Get resolved function from module table
+			sol::protected_function getScriptFunction(ScriptModule& module, std::string const& function);
+
+			//Get argument table of entity script, rewritten only when named args change
+			sol::table getScriptArgs(Script const& script, Entity::Type entity);
+
+			//Call resolved function, throws on lua error
+			sol::object callScriptFunction(sol::protected_function const& function, Script const& script, Entity::Type entity);
+
 			//Internal get sol table asset
-			std::shared_ptr<sol::load_result> getLuaAssset(std::string const& script_id) const;
+			std::shared_ptr<sol::load_result> getLuaAssset(Utility::StringID script_handle) const;
 
 			//Uncache lua asset
 			void uncacheLuaAsset(std::string const& script_id) const;
 
-			//Convert script to sol::table args
-			sol::table convertScriptArgs(Script const& script) const;
+			//Drop cached args of destroyed entities
+			void onEvent(std::shared_ptr<Coordinator::EntitiesChanged> event) override;
 		public:
 			Service() = default;
 			~Service() = default;
@@ -153,79 +190,14 @@ namespace NIKE {
 				}
 			}
 
-			//Execute lua script based on asset service id
-			template<typename ...Args>
-			sol::object executeScript(Script & script) {
-
-				try {
-					//Get script table from asset service
-					auto loaded_script = getLuaAssset(script.script_id);
+			//Execute lua script based on asset service id ( Module & args are cached, entity keys the args table )
+			sol::object executeScript(Script& script, Entity::Type entity);
 
-					//Check if script is loaded correctly
-					if (!loaded_script->valid()) {
-						throw std::runtime_error("Invalid Lua script: script is not loaded correctly.");
-					}
-
-					//Execute script
-					sol::protected_function_result result = (*loaded_script)();
-
-					//Convert result into a table
-					sol::table script_table = result;
-
-					if (!script.start_function.empty() && !script.start_function_executed) {
-						sol::function start_function = script_table[script.start_function];
-						if (start_function.valid()) {
-							NIKEE_CORE_INFO("Executing start function: {}", script.start_function);
-
-							// Execute the start function
-							start_function(script.named_args.size(), convertScriptArgs(script));
-
-							// Mark the start function as executed
-							script.start_function_executed = true;
-						}
-						else {
-							throw std::runtime_error("Start function not found in script table: " + script.start_function);
-						}
-					}
-
-					//No function to be called
-					if (script.update_function.empty()) {
+			//Drop cached module of script ( Script uncached or hot reloaded )
+			void invalidateScriptModule(std::string const& script_id);
 
-						//Execute script table
-						if (result.get_type() == sol::type::table) {
-							return sol::make_object(loaded_script->lua_state(), result);
-						}
-
-						//Execute script function
-						else {
-							sol::object returned_value = result[0];
-							sol::function lua_function = returned_value.as<sol::function>();
-							return lua_function();
-						}
-					}
-
-					//Check if result here is not a table
-					if (result.get_type() != sol::type::table) {
-						throw std::runtime_error("Error! Cant call a function from a function script!");
-					}
-
-
-
-					//Function to be called
-					sol::function script_function = script_table[script.update_function];
-					if (!script_function.valid()) {
-						throw std::runtime_error("Function not found in script table: " + script.update_function);
-					}
-
-					//Execute the Lua function with provided arguments
-					return script_function(script.named_args.size(), convertScriptArgs(script));
-				}
-				catch (std::runtime_error const& e) {
-					NIKEE_CORE_WARN(e.what());
-					uncacheLuaAsset(script.script_id);
-					return sol::nil;
-				}
-			}
+			//Drop all cached modules ( Scene load, module locals start fresh )
+			void invalidateScriptModules();
 
 			//Get all lua global functions
 			std::unordered_set<std::string> getGlobalLuaFunctions() const;
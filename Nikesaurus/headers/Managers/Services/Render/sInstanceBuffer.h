@@ -0,0 +1,140 @@
+/*****************************************************************//**
+ * \file   sInstanceBuffer.h
+ * \brief  Per instance data and persistently mapped instance ring for batched rendering
+ *
+ * \author agent, agent@local (100%)
+ * \date   October 2026
+ * All content © 2026 DigiPen Institute of Technology Singapore, all rights reserved.
+ *********************************************************************/
+
+#pragma once
+
+#ifndef RENDER_INSTANCE_BUFFER_HPP
+#define RENDER_INSTANCE_BUFFER_HPP
+
+namespace NIKE {
+	namespace Render {
+
+		//Temporary Disable DLL Export Warning
+		#pragma warning(disable: 4251)
+
+		//Render instance queued for batching
+		struct RenderInstance {
+			Matrix_33 xform{};
+			bool to_blend_color = false;
+			Vector4f color{};
+			unsigned int tex{};
+			unsigned int sampler_idx{};
+			Vector2f framesize{};
+			Vector2f uv_offset{};
+			float blend_intensity{};
+		};
+
+		//Compact per instance record read by the batched shaders ( Attribute divisor 1 )
+		struct InstanceData {
+			//Affine columns of the column major model to ndc matrix ( Third row is always 0 0 1 )
+			std::array<float, 6> xform{};
+
+			//Texture sub rect
+			std::array<float, 2> uv_offset{};
+			std::array<float, 2> framesize{};
+
+			//RGBA8 color
+			std::array<uint8_t, 4> color{};
+
+			//Index into batched sampler array
+			uint8_t sampler_idx{};
+
+			//Blend texture with color ( 0 or 1 )
+			uint8_t blend{};
+
+			//Blend intensity as unorm16
+			uint16_t blend_intensity{};
+		};
+
+		static_assert(sizeof(InstanceData) == 48, "InstanceData must stay tightly packed, update the instance attribute offsets if it changes.");
+
+		/*****************************************************************//**
+		* Instance packing ( CPU only, no GL calls )
+		*********************************************************************/
+		namespace InstancePacking {
+
+			//Pack affine columns of a column major matrix
+			NIKE_API std::array<float, 6> packTransform(Matrix_33 const& x_form);
+
+			//Pack color to RGBA8 ( Clamped to [0, 1] )
+			NIKE_API std::array<uint8_t, 4> packColor(Vector4f const& color);
+
+			//Pack float to unorm16 ( Clamped to [0, 1] )
+			NIKE_API uint16_t packUnorm16(float value);
+
+			//Pack single render instance
+			NIKE_API InstanceData packInstance(RenderInstance const& instance);
+
+			//Pack render instances into destination ( Destination must hold instances.size() records )
+			NIKE_API void packInstances(std::vector<RenderInstance> const& instances, InstanceData* dst);
+		}
+
+		/*****************************************************************//**
+		* Instance ring
+		*********************************************************************/
+		class NIKE_API InstanceRing {
+		public:
+			//Segments in flight ( Triple buffered )
+			static constexpr unsigned int NUM_SEGMENTS = 3;
+
+			//Vertex buffer binding index used for instance data
+			static constexpr unsigned int BINDING_INDEX = 11;
+
+			//Batched shader attribute locations
+			static constexpr unsigned int XFORM_ATTRIB_INDEX = 4;
+			static constexpr unsigned int FRAMESIZE_ATTRIB_INDEX = 8;
+			static constexpr unsigned int UVOFFSET_ATTRIB_INDEX = 9;
+			static constexpr unsigned int SAMPLERIDX_ATTRIB_INDEX = 2;
+			static constexpr unsigned int BLEND_ATTRIB_INDEX = 11;
+			static constexpr unsigned int COLOR_ATTRIB_INDEX = 12;
+			static constexpr unsigned int BLENDINTENSITY_ATTRIB_INDEX = 13;
+
+			InstanceRing() : buffer{ 0 }, mapped{ nullptr }, segment_capacity{ 0 }, segment{ 0 }, cursor{ 0 }, fences{} {}
+			~InstanceRing() = default;
+
+			//Create and persistently map buffer ( Requires GL context )
+			void init(unsigned int capacity_per_segment);
+
+			//Unmap and delete buffer
+			void cleanup();
+
+			//Reserve space for count instances ( Returns write pointer, base_instance receives offset for draw call )
+			InstanceData* allocate(unsigned int count, unsigned int& base_instance);
+
+			//Fence current segment and move on to the next ( Called once per frame )
+			void advance();
+
+			//Attach instance buffer to vertex array binding
+			void bind(unsigned int vaoid) const;
+
+			//Setup instance attribute formats on vertex array ( Buffer attached later through bind )
+			static void setupAttributes(unsigned int vaoid);
+
+		private:
+			//Delete Copy Constructor & Copy Assignment
+			InstanceRing(InstanceRing const& copy) = delete;
+			void operator=(InstanceRing const& copy) = delete;
+
+			//Wait for GPU to finish reading a segment
+			void waitSegment(unsigned int index);
+
+			unsigned int buffer;
+			InstanceData* mapped;
+			unsigned int segment_capacity;
+			unsigned int segment;
+			unsigned int cursor;
+			std::array<GLsync, NUM_SEGMENTS> fences;
+		};
+
+		//Re-enable DLL Export warning
+		#pragma warning(default: 4251)
+	}
+}
+
+#endif //!RENDER_INSTANCE_BUFFER_HPP
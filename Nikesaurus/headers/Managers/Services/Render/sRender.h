@@ -15,6 +15,8 @@
 #include "Components/cRender.h"
 #include "Managers/Services/Render/sParticle.h"
 #include "Managers/Services/Render/sVideoPlayer.h"
+#include "Managers/Services/Render/sInstanceBuffer.h"
+#include "Managers/Services/Render/sRenderQueue.h"
 
 #ifndef RENDER_SERVICE_HPP
 #define RENDER_SERVICE_HPP
@@ -22,16 +24,6 @@
 namespace NIKE {
 	namespace Render {
 
-		struct RenderInstance {
-			Matrix_33 xform{};
-			bool to_blend_color = false;
-			Vector4f color{};
-			unsigned int tex{};
-			Vector2f framesize{};
-			Vector2f uv_offset{};
-			float blend_intensity{};
-		};
-
 		struct FramebufferTexture {
 			unsigned int frame_buffer{};
 			unsigned int texture_color_buffer{};
@@ -57,6 +49,21 @@ namespace NIKE {
 			TextBuffer() : vao{ 0 }, vbo{ 0 } {};
 		};
 
+		//Components read when rendering an entity ( nullptr when absent )
+		struct RenderComponents {
+			Transform::Transform* transform;
+			Render::Texture* texture;
+			Render::Shape* shape;
+			Physics::Collider* collider;
+			Physics::Dynamics* dynamics;
+			Render::Text* text;
+			Render::ParticleEmitter* particle;
+			Render::Video* video;
+
+			//Default constructor
+			RenderComponents() : transform{ nullptr }, texture{ nullptr }, shape{ nullptr }, collider{ nullptr }, dynamics{ nullptr }, text{ nullptr }, particle{ nullptr }, video{ nullptr } {};
+		};
+
 		enum class FADE_STATE {
 			NONE = 0,
 			FADE_IN,
@@ -105,23 +112,19 @@ namespace NIKE {
 				//Map of framebuffer
 				std::unordered_map<unsigned int, FramebufferTexture> frame_buffers;
 
-				//Queue of world render
-				std::queue<std::function<void()>> world_render_queue;
-
-				//Queue of world text render
-				std::queue<std::function<void()>> world_text_render_queue;
+				//Sorted render commands of current frame
+				RenderQueue render_queue;
 
-				//Queue of world particle render
-				std::queue<std::function<void()>> world_particle_render_queue;
+				//Draw command payloads
+				void drawShape(ShapeCommand const& cmd);
+				void drawTexture(TextureCommand const& cmd);
+				void drawVideo(VideoCommand const& cmd);
 
-				//Queue of screen render
-				std::queue<std::function<void()>> screen_render_queue;
+				//Execute render command
+				void executeCommand(RenderCommand const& cmd);
 
-				//Queue of screen text render
-				std::queue<std::function<void()>> screen_text_render_queue;
-
-				//Queue of screen particle render
-				std::queue<std::function<void()>> screen_particle_render_queue;
+				//Draw pending batches
+				void flushBatches();
 
 			public:
 
@@ -129,10 +132,15 @@ namespace NIKE {
 
 				//Rendering constants
 				const bool BATCHED_RENDERING = true;
-				static constexpr unsigned int MAX_INSTANCES = 500;
-				static constexpr int MAX_UNIQUE_TEX_HDLS = 32;
+				static constexpr unsigned int MAX_INSTANCES = 4096;
+				static constexpr int MAX_UNIQUE_TEX_HDLS = 31;
 				static constexpr int NUM_INDICES_FOR_QUAD = 6;
 				static constexpr int NUM_VERTICES_IN_MODEL = 4;
+				static constexpr unsigned int INSTANCES_PER_RING_SEGMENT = MAX_INSTANCES * 4;
+
+				//Texture atlas is bound after the standalone texture slots, sampler indices from this base select an atlas layer
+				static constexpr int ATLAS_TEXTURE_UNIT = MAX_UNIQUE_TEX_HDLS;
+				static constexpr unsigned int ATLAS_SAMPLER_BASE = MAX_UNIQUE_TEX_HDLS;
 
 				Service() = default;
 				~Service() = default;
@@ -207,15 +215,31 @@ namespace NIKE {
 				//Render particle system
 				void renderParticleSystem(const NIKE::SysParticle::ParticleSystem& ps, bool use_screen_pos = false, const std::string& texture_ref = std::string{});
 
-				//Render entity
+				//Render entity from component map ( Prefab preview )
 				void renderComponents(std::unordered_map<std::string, std::shared_ptr<void>> comps, bool debug = false);
 
+				//Render entity components
+				void renderComponents(RenderComponents const& comps, bool debug = false);
+
+				//Render entity, components are read through its signature
+				void renderEntity(Entity::Type entity, bool debug = false);
+
 				/*****************************************************************//**
 				* BATCH RENDERING
 				*********************************************************************/
 
-				// Stores unique texture handles for the current batch
-				static std::unordered_set<unsigned int> curr_instance_unique_tex_hdls;
+				// Texture handles bound for the current texture batch (index is the sampler slot)
+				std::array<unsigned int, MAX_UNIQUE_TEX_HDLS> batch_tex_hdls{};
+				unsigned int batch_tex_count{};
+
+				// Sampler slots uploaded to u_tex2d
+				std::vector<unsigned int> batch_tex_units;
+
+				// Persistently mapped instance data shared by all batches
+				InstanceRing instance_ring;
+
+				// Get sampler slot of texture in current batch (flushes batch when all slots are taken)
+				unsigned int getBatchTextureSlot(unsigned int tex_hdl);
 
 				// Shapes render instance
 				std::vector<RenderInstance> render_instances_quad;
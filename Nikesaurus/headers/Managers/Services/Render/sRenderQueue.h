@@ -0,0 +1,200 @@
+/*****************************************************************//**
+ * \file   sRenderQueue.h
+ * \brief  Sort key render command queue
+ *
+ * \author agent, agent@local (100%)
+ * \date   October 2026
+ * All content © 2026 DigiPen Institute of Technology Singapore, all rights reserved.
+ *********************************************************************/
+
+#pragma once
+
+#ifndef RENDER_QUEUE_HPP
+#define RENDER_QUEUE_HPP
+
+#include "Components/cRender.h"
+#include "Managers/Services/Render/sParticle.h"
+
+namespace NIKE {
+	namespace Render {
+
+		//Temporary Disable DLL Export Warning
+		#pragma warning(disable: 4251)
+
+		//Render passes, executed in enum order
+		enum class RenderPass : uint8_t {
+			WORLD = 0,
+			WORLD_TEXT,
+			WORLD_PARTICLE,
+			SCREEN,
+			SCREEN_TEXT,
+			SCREEN_PARTICLE
+		};
+
+		//Command types, commands sharing a depth execute in enum order
+		enum class CommandType : uint8_t {
+			TEXTURE = 0,
+			SHAPE,
+			BOUNDING_BOX,
+			VIDEO,
+			TEXT,
+			PARTICLE
+		};
+
+		//Texture draw ( Flip is baked into transform )
+		struct TextureCommand {
+			Matrix_33 xform;
+			Utility::StringID texture_id;
+			Vector4f color;
+			Vector2i frame_size;
+			Vector2i frame_index;
+			bool b_blend;
+			float intensity;
+		};
+
+		//Shape draw
+		struct ShapeCommand {
+			Matrix_33 xform;
+			Utility::StringID model_id;
+			Vector4f color;
+			bool use_override_color;
+		};
+
+		//Debug bounding box draw
+		struct BoundingBoxCommand {
+			Matrix_33 xform;
+			Vector4f color;
+		};
+
+		//Video frame draw
+		struct VideoCommand {
+			Matrix_33 xform;
+			unsigned int texture_id;
+		};
+
+		//Text draw ( Text component is read when the command executes, within the same frame )
+		struct TextCommand {
+			Matrix_33 xform;
+			Render::Text* text;
+		};
+
+		//Particle system draw
+		struct ParticleCommand {
+			SysParticle::ParticleSystem const* system;
+			bool use_screen_pos;
+		};
+
+		//Render command, payload indexes into the per frame payload array of its type
+		struct RenderCommand {
+			uint64_t key;
+			uint32_t payload;
+			CommandType type;
+		};
+
+		/*****************************************************************//**
+		* Sort key
+		*
+		* | pass (3) | depth (32) | type (8) | material (21) |
+		*
+		* Depth is the submission index of the entity, which already follows
+		* layer order and y-sorting. Sprites overlap, so depth must stay above
+		* material for correct draw order. Material only orders commands that
+		* share a depth.
+		*********************************************************************/
+		namespace SortKey {
+			static constexpr int MATERIAL_BITS = 21;
+			static constexpr int TYPE_BITS = 8;
+			static constexpr int DEPTH_BITS = 32;
+			static constexpr int PASS_BITS = 3;
+
+			static constexpr int TYPE_SHIFT = MATERIAL_BITS;
+			static constexpr int DEPTH_SHIFT = TYPE_SHIFT + TYPE_BITS;
+			static constexpr int PASS_SHIFT = DEPTH_SHIFT + DEPTH_BITS;
+
+			static constexpr uint64_t MATERIAL_MASK = (uint64_t(1) << MATERIAL_BITS) - 1;
+
+			//Build sort key
+			constexpr uint64_t make(RenderPass pass, uint32_t depth, CommandType type, uint32_t material) {
+				return (static_cast<uint64_t>(pass) << PASS_SHIFT)
+					| (static_cast<uint64_t>(depth) << DEPTH_SHIFT)
+					| (static_cast<uint64_t>(type) << TYPE_SHIFT)
+					| (static_cast<uint64_t>(material) & MATERIAL_MASK);
+			}
+
+			//Get pass from sort key
+			constexpr RenderPass getPass(uint64_t key) {
+				return static_cast<RenderPass>(key >> PASS_SHIFT);
+			}
+		}
+
+		//LSD radix sort by key, 8 bits per digit, digits shared by every key are skipped ( Stable )
+		NIKE_API void radixSortCommands(std::vector<RenderCommand>& commands, std::vector<RenderCommand>& scratch);
+
+		/*****************************************************************//**
+		* Render queue
+		*********************************************************************/
+		class NIKE_API RenderQueue {
+		private:
+			//Commands for this frame
+			std::vector<RenderCommand> commands;
+
+			//Sort scratch buffer
+			std::vector<RenderCommand> scratch;
+
+			//Per frame payload arenas ( Cleared every frame, capacity is kept )
+			std::vector<TextureCommand> textures;
+			std::vector<ShapeCommand> shapes;
+			std::vector<BoundingBoxCommand> bounding_boxes;
+			std::vector<VideoCommand> videos;
+			std::vector<TextCommand> texts;
+			std::vector<ParticleCommand> particles;
+
+			//Depth counter
+			uint32_t depth;
+
+			//Push payload and command
+			template<typename T>
+			void push(std::vector<T>& payloads, T const& payload, RenderPass pass, uint32_t cmd_depth, CommandType type, uint32_t material) {
+				commands.push_back({ SortKey::make(pass, cmd_depth, type, material), static_cast<uint32_t>(payloads.size()), type });
+				payloads.push_back(payload);
+			}
+
+		public:
+			RenderQueue() : depth{ 0 } {}
+			~RenderQueue() = default;
+
+			//Get depth for next submission
+			uint32_t nextDepth() { return depth++; }
+
+			//Submit commands
+			void submit(RenderPass pass, uint32_t cmd_depth, TextureCommand const& cmd) { push(textures, cmd, pass, cmd_depth, CommandType::TEXTURE, cmd.texture_id); }
+			void submit(RenderPass pass, uint32_t cmd_depth, ShapeCommand const& cmd) { push(shapes, cmd, pass, cmd_depth, CommandType::SHAPE, cmd.model_id); }
+			void submit(RenderPass pass, uint32_t cmd_depth, BoundingBoxCommand const& cmd, uint32_t order = 0) { push(bounding_boxes, cmd, pass, cmd_depth, CommandType::BOUNDING_BOX, order); }
+			void submit(RenderPass pass, uint32_t cmd_depth, VideoCommand const& cmd) { push(videos, cmd, pass, cmd_depth, CommandType::VIDEO, cmd.texture_id); }
+			void submit(RenderPass pass, uint32_t cmd_depth, TextCommand const& cmd) { push(texts, cmd, pass, cmd_depth, CommandType::TEXT, 0); }
+			void submit(RenderPass pass, uint32_t cmd_depth, ParticleCommand const& cmd) { push(particles, cmd, pass, cmd_depth, CommandType::PARTICLE, 0); }
+
+			//Sort commands by key
+			void sort();
+
+			//Get sorted commands
+			std::vector<RenderCommand> const& getCommands() const { return commands; }
+
+			//Get payloads
+			TextureCommand const& getTexture(uint32_t index) const { return textures[index]; }
+			ShapeCommand const& getShape(uint32_t index) const { return shapes[index]; }
+			BoundingBoxCommand const& getBoundingBox(uint32_t index) const { return bounding_boxes[index]; }
+			VideoCommand const& getVideo(uint32_t index) const { return videos[index]; }
+			TextCommand const& getText(uint32_t index) const { return texts[index]; }
+			ParticleCommand const& getParticle(uint32_t index) const { return particles[index]; }
+
+			//Clear commands and payloads for next frame
+			void clear();
+		};
+
+		//Re-enable DLL Export warning
+		#pragma warning(default: 4251)
+	}
+}
+
+#endif //!RENDER_QUEUE_HPP
@@ -23,7 +23,7 @@ namespace NIKE {
 		class NIKE_API Service
 		{
 		public:
-			Service() : total_system_time{ 0.0 }{}
+			Service() : total_system_time{ 0.0 }, render_visible_count{ 0 }, render_culled_count{ 0 } {}
 			~Service() = default;
 
 			// Check for system runtime 
@@ -34,11 +34,24 @@ namespace NIKE {
 
 			//Get total system time
 			double getTotalSystemTime() const;
+
+			//Update render culling counts of last frame
+			void updateRenderCulling(int visible_count, int culled_count);
+
+			//Get entities rendered last frame
+			int getRenderVisibleCount() const;
+
+			//Get entities culled last frame
+			int getRenderCulledCount() const;
 		private:
 
 			std::vector<std::pair<std::string, double>> system_percentages;
 			double total_system_time;
 
+			//Render culling counts
+			int render_visible_count;
+			int render_culled_count;
+
 			//Delete Copy Constructor & Copy Assignment
 			Service(Service const& copy) = delete;
 			void operator=(Service const& copy) = delete;
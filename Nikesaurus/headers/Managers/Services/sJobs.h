@@ -0,0 +1,80 @@
+/*****************************************************************//**
+ * \file   sJobs.h
+ * \brief  Job system declarations
+ *
+ * \author agent, agent@local (100%)
+ * \date   October 2026
+ * All content © 2026 DigiPen Institute of Technology Singapore, all rights reserved.
+ *********************************************************************/
+#pragma once
+
+#ifndef JOBS_SERVICE_HPP
+#define JOBS_SERVICE_HPP
+
+namespace NIKE {
+	namespace Jobs {
+
+		//Job function over index range [begin, end)
+		using RangeFunc = std::function<void(size_t begin, size_t end)>;
+
+		//Job global service ( fixed pool of worker threads for parallel loops )
+		class Service {
+		private:
+
+			//Delete Copy Constructor & Copy Assignment
+			Service(Service const& copy) = delete;
+			void operator=(Service const& copy) = delete;
+
+			//Worker threads
+			std::vector<std::thread> workers;
+
+			//Job synchronization
+			std::mutex job_mutex;
+			std::condition_variable job_cv;
+			std::condition_variable done_cv;
+
+			//Current job
+			RangeFunc const* job_func;
+			size_t job_count;
+			size_t job_grain;
+			std::atomic<size_t> job_next;
+
+			//Job generation ( bumped for every job so sleeping workers pick it up once )
+			uint64_t job_generation;
+
+			//Workers still running current job
+			size_t job_busy;
+
+			//First exception thrown by current job
+			std::exception_ptr job_exception;
+
+			//Shutdown flag
+			bool b_shutdown;
+
+			//Worker thread loop
+			void workerLoop();
+
+			//Run chunks of current job until none are left
+			void runChunks();
+		public:
+
+			//Default constructor and destructor
+			Service();
+			~Service();
+
+			//Init worker threads ( 0 uses hardware concurrency - 1 )
+			void init(size_t worker_count = 0);
+
+			//Stop and join worker threads
+			void shutdown();
+
+			//Get number of worker threads ( excluding calling thread )
+			size_t getWorkerCount() const;
+
+			//Split [0, count) into chunks of grain and run them across workers & calling thread, blocks until done
+			void parallelFor(size_t count, size_t grain, RangeFunc const& func);
+		};
+	}
+}
+
+#endif //!JOBS_SERVICE_HPP
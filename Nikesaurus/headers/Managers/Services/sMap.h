@@ -17,56 +17,105 @@
 #define DEFAULT_GRID_SIZE Vector2i{1,1}
 #define DEFAULT_CELL_SIZE Vector2f{256.f,256.f}
 
+//Hierarchical pathfinding cluster size in cells
+#define PATH_CLUSTER_SIZE 10
+
+//Border runs this long or longer get an entrance at each end instead of one in the middle
+#define PATH_ENTRANCE_SPLIT 6
+
+//Default time spent solving queued path requests per frame ( microseconds )
+#define DEFAULT_PATH_BUDGET 2000
+
+//Number of changed grid regions kept for path invalidation queries
+#define GRID_REGION_HISTORY 64
+
 namespace NIKE {
 	namespace Map {
 		//Temporary Disable DLL Export Warning
 		#pragma warning(disable: 4251)
 
-		struct Cell {
-			bool b_blocked;
-			bool b_blocked_prev;
-			Vector2f position;
-			Vector2i index;
+		//Rectangle of changed cells ( inclusive bounds )
+		struct GridRegion {
+			Vector2i min;
+			Vector2i max;
 
-			// Ah ho uses Cell* as parent
-			// Ah lim uses Vectori as parent
-			//Vector2i parent;
+			//Grid generation region was published in
+			uint64_t generation;
+		};
 
-			Cell* parent = nullptr;
+		//A* search node ( flat row-major array indexed y * width + x, reused across searches )
+		struct PathNode {
 
-			// Values used by the A* algorithm
 			/////////////////////////////////////////////////////////////////////////////////
 			// G(cost from start) is the cost to reach a node from the start node
 			// H(Heuristic cost to goal) is an estimate cost from current node to the goal
-			// F(Total Cost) is the value used to prio nodes in prio queue
+			// F(Total Cost) is the value used to prio nodes in the open heap
 			/////////////////////////////////////////////////////////////////////////////////
-			int f, g, h;
+			int g, h, f;
 
-			Cell(int _x, int _y) : b_blocked{ false }, b_blocked_prev{ false }, position {}, index{ _x, _y }, f{ 0 }, g{ 0 }, h{ 0 }
-			{
-			}
+			//Flat index of parent node
+			int parent;
 
-			Cell(Vector2i input) : b_blocked{ false }, b_blocked_prev{ false }, position{}, index{ input.x, input.y }, f{ 0 }, g{ 0 }, h{ 0 }
-			{
-			}
+			//Search stamp node was last reached in ( node data is stale otherwise )
+			uint32_t visited;
 
-			Cell() : b_blocked{ false }, b_blocked_prev{ false }, position{}, index{}, f{ 0 }, g{ 0 }, h{ 0 }
-			{
-			}
+			//Index in open heap ( -1 when not in heap )
+			int heap_index;
 
-			//Lesser Than Comparison
-			bool operator<(Cell const& other) const;
+			//Node has been expanded
+			bool b_closed;
 
-			//Greater Than Comparison
-			bool operator>(Cell const& other) const;
+			PathNode() : g{ 0 }, h{ 0 }, f{ 0 }, parent{ -1 }, visited{ 0 }, heap_index{ -1 }, b_closed{ false } {}
 		};
 
-		//Path data object
+		//Path data object ( cell indices from first step to end )
 		struct Path {
-			std::deque<Cell> path;
-			Cell end;
-			Cell goal;
+			std::vector<Vector2i> path;
+
+			//Cluster entrances still to be refined after last path cell ( hierarchical paths only )
+			std::vector<Vector2i> waypoints;
+
+			Vector2i end;
+			Vector2i goal;
 			bool b_finished;
+
+			//Grid generation path was searched against
+			uint64_t generation;
+
+			Path() : path(), waypoints(), end(), goal(), b_finished{ false }, generation{ 0 } {}
+		};
+
+		//Path request callback ( invoked once path has been published )
+		using PathCallback = std::function<void(Entity::Type, Path const&)>;
+
+		//Queued path request
+		struct PathRequest {
+			Vector2i start;
+			Vector2i goal;
+			bool b_diagonal;
+			PathCallback callback;
+
+			PathRequest() : start(), goal(), b_diagonal{ false }, callback() {}
+		};
+
+		//Fixed size block of grid cells for hierarchical pathfinding
+		struct PathCluster {
+
+			//Cell bounds
+			Vector2i origin;
+			Vector2i size;
+
+			//Entrance cells ( flat row-major indices )
+			std::vector<int> nodes;
+
+			//Cost between entrance nodes within cluster ( nodes.size() squared, -1 when unreachable )
+			std::vector<int> distances;
+
+			//Entrances into right & lower neighbour ( cell in this cluster, cell in neighbour )
+			std::vector<std::pair<int, int>> right_transitions;
+			std::vector<std::pair<int, int>> down_transitions;
+
+			PathCluster() : origin(), size(), nodes(), distances(), right_transitions(), down_transitions() {}
 		};
 
 		class NIKE_API Service 
@@ -104,24 +153,30 @@ namespace NIKE {
 			// Reset cell size and grid size
 			void resetGrid();
 
-			//Get cell cursor is in
-			std::optional<std::reference_wrapper<Map::Cell>> getCursorCell();
-
-			//Get cell based on position
-			std::optional<std::reference_wrapper<Map::Cell>> getCellAtPosition(Vector2f const& position);
+			//Get index of cell cursor is in
+			std::optional<Vector2i> getCursorCell() const;
 
 			//Get cell index based on world cords
 			std::optional<Vector2i> getCellIndexFromCords(Vector2f const& position);
 
-			//Get grid
-			std::vector<std::vector<Cell>>const& getGrid() const;
+			//Get world position of cell index
+			Vector2f getCellPosition(Vector2i const& index) const;
 
-			//Cell state checking
+			//Publish cells changed since last update
 			void gridUpdate();
 
 			//Check grid changed
 			bool checkGridChanged() const;
 
+			//Get grid generation ( bumped every update that publishes changed cells )
+			uint64_t getGridGeneration() const;
+
+			//Check if any cell within bounds changed after generation
+			bool isRegionChanged(Vector2i const& min, Vector2i const& max, uint64_t since_generation) const;
+
+			//Check if cells changed along entity path since it was searched
+			bool isPathAffected(Entity::Type entity) const;
+
 			//Serialize map
 			nlohmann::json serialize() const;
 
@@ -131,18 +186,57 @@ namespace NIKE {
 			//Pathfinding
 			void findPath(Entity::Type entity, Vector2i const& start, Vector2i const& goal, bool b_diagonal = false);
 
-			//Get entity path
-			Path getPath(Entity::Type entity);
+			//Get entity path ( empty path if none )
+			Path const& getPath(Entity::Type entity) const;
 
 			//Check entity path
 			bool checkPath(Entity::Type entity) const;
+
+			//Refine next cluster of a hierarchical entity path
+			void refinePath(Entity::Type entity);
+
+			//Queue path search ( replaces pending request of entity, current path is kept until result is published )
+			void requestPath(Entity::Type entity, Vector2i const& start, Vector2i const& goal, bool b_diagonal = false, PathCallback callback = nullptr);
+
+			//Check if entity has a pending path request
+			bool isPathPending(Entity::Type entity) const;
+
+			//Solve & publish queued path requests within frame budget ( sync point, grid must not change during call )
+			void updatePathRequests();
+
+			//Set per frame path budget in microseconds
+			void setPathBudget(int microseconds);
+
+			//Get per frame path budget in microseconds
+			int getPathBudget() const;
+
+			//Check if straight line between cell centres crosses only open cells ( corners need both sides open )
+			bool hasLineOfSight(Vector2i const& from, Vector2i const& to) const;
+
+			//String pull path into cells with line of sight between each other ( start excluded )
+			std::vector<Vector2i> smoothPath(Vector2i const& start, std::vector<Vector2i> const& path) const;
+
+			//Rebuild shared flow field toward goal ( only when goal, mode or grid changed )
+			void updateFlowField(Vector2i const& goal, bool b_diagonal = false);
+
+			//Get next cell toward flow field goal ( nullopt at goal or when unreachable )
+			std::optional<Vector2i> getFlowStep(Vector2i const& from) const;
+
+			//Get flow field cost to goal ( -1 when unreachable )
+			int getFlowCost(Vector2i const& from) const;
 		private:
 
 			//On entities changed event
 			void onEvent(std::shared_ptr<Coordinator::EntitiesChanged> event) override;
 
-			//Internal cell pos update
-			void updateCells();
+			//Internal grid scale update
+			void updateGridScale();
+
+			//Resize occupancy to grid size keeping overlapping cells
+			void resizeOccupancy(Vector2i const& old_size);
+
+			//Blocked bit of flat cell index
+			bool isBlockedAt(int cell) const;
 
 			//On mouse move event
 			void onEvent(std::shared_ptr<Input::MouseMovedEvent> event) override;
@@ -150,8 +244,108 @@ namespace NIKE {
 			//Pathfinding paths
 			std::unordered_map<Entity::Type, Path> paths;
 
-			//Grid vector
-			std::vector<std::vector<Cell>> grid;
+			//Pending path requests ( one per entity )
+			std::unordered_map<Entity::Type, PathRequest> path_requests;
+
+			//Order pending requests were first queued in
+			std::deque<Entity::Type> path_request_order;
+
+			//Per frame path budget in microseconds
+			int path_budget;
+
+			//A* nodes ( flat row-major )
+			std::vector<PathNode> path_nodes;
+
+			//A* open list ( binary min heap of flat node indices )
+			std::vector<int> open_heap;
+
+			//Current search stamp
+			uint32_t search_stamp;
+
+			//Open heap ordering ( lower f, then h, then g, then index )
+			bool isNodeBefore(int lhs, int rhs) const;
+
+			//Open heap operations
+			void openPush(int node);
+			int openPop();
+			void openSiftUp(size_t heap_pos);
+			void openSiftDown(size_t heap_pos);
+
+			//Prepare nodes & open heap for a new search
+			void beginSearch(size_t node_count);
+
+			//Cell level A* ( appends cells after start, toward closest reachable cell when goal unreachable )
+			bool searchPath(Vector2i const& start, Vector2i const& goal, bool b_diagonal, std::vector<Vector2i>& out_path);
+
+			//Clusters for hierarchical pathfinding ( row-major )
+			std::vector<PathCluster> clusters;
+
+			//Number of clusters along each axis
+			Vector2i cluster_count;
+
+			//Clusters changed since last cluster update
+			std::unordered_set<int> dirty_clusters;
+
+			//Scratch buffers for cluster searches
+			std::vector<int> cluster_queue;
+			std::vector<int> cluster_costs;
+			std::vector<int> start_costs;
+			std::vector<int> goal_costs;
+
+			//Get cluster containing flat cell index
+			int getClusterIndex(int cell) const;
+
+			//Rebuild every cluster
+			void buildClusters();
+
+			//Rebuild dirty clusters & their neighbours
+			void updateClusters();
+
+			//Rebuild entrances on right & lower border of cluster
+			void buildClusterBorders(int cluster_index);
+
+			//Rebuild entrance nodes & intra cluster distances
+			void buildClusterNodes(int cluster_index);
+
+			//Costs from source cell to every cell in cluster ( local row-major, -1 when unreachable )
+			void clusterCosts(int cluster_index, int source, std::vector<int>& costs);
+
+			//A* over cluster entrances ( appends abstract nodes after start )
+			bool searchClusterPath(Vector2i const& start, Vector2i const& goal, std::vector<int>& out_nodes);
+
+			//Refine path waypoints until path leaves the cluster of from
+			void refineNextCluster(Path& path, Vector2i const& from);
+
+			//Flow field integrated cost to goal per cell ( flat row-major, -1 when unreachable )
+			std::vector<int> flow_costs;
+
+			//Flow field next cell toward goal per cell ( flat index, -1 when none )
+			std::vector<int> flow_next;
+
+			//Flow field open list ( packed cost & index min heap )
+			std::vector<uint64_t> flow_frontier;
+
+			//Flow field goal & mode
+			Vector2i flow_goal;
+			bool b_flow_diagonal;
+
+			//Flow field is up to date with grid
+			bool b_flow_valid;
+
+			//Changed regions waiting for next grid update
+			std::vector<GridRegion> pending_regions;
+
+			//Recently published changed regions ( oldest first )
+			std::deque<GridRegion> changed_regions;
+
+			//Current grid generation
+			uint64_t grid_generation;
+
+			//Newest generation dropped from region history
+			uint64_t trimmed_generation;
+
+			//Blocked cells bitmap ( flat row-major, 64 cells per word )
+			std::vector<uint64_t> occupancy;
 
 			//Grid size
 			Vector2i grid_size;
@@ -37,7 +37,7 @@ namespace NIKE {
 			std::string name;
 
 			//Prefab tag
-			std::string prefab_id;
+			Utility::InternedString prefab_id;
 
 			//Override data for variant prefab
 			nlohmann::json prefab_override;
@@ -83,11 +83,11 @@ namespace NIKE {
 			//Default entity name
 			std::string def_name;
 
-			//Ecs entities
-			std::set<Entity::Type> ecs_entities;
-
-			//Entities name mapping
+			//Entities name mapping ( kept in sync with entity names )
 			std::unordered_map<std::string, Entity::Type> entity_names;
+
+			//Entities per tag ( inverted index of entity tags )
+			std::unordered_map<Utility::StringID, std::set<Entity::Type>> tag_entities;
 				 
 			//Sort entities
 			struct EntitySorter {
@@ -105,8 +105,14 @@ namespace NIKE {
 			//On entities changed event
 			void onEvent(std::shared_ptr<Coordinator::EntitiesChanged> event) override;
 
-			//Update entities data
-			void updateData();
+			//Set default name from entity id
+			void setDefaultName(Entity::Type entity);
+
+			//Add entity name & tags to indices
+			void indexEntity(Entity::Type entity);
+
+			//Remove entity name & tags from indices
+			void unindexEntity(Entity::Type entity);
 
 		public:
 
@@ -119,6 +125,9 @@ namespace NIKE {
 			//Update
 			void update();
 
+			//Register entity created in the ECS ( Called before EntitiesChanged when entity creation is batched )
+			void registerEntity(Entity::Type entity);
+
 			//Check if type is valid
 			bool isTagValid(std::string const& tag);
 
@@ -162,7 +171,7 @@ namespace NIKE {
 			void removeEntityTag(Entity::Type entity, std::string const& tag);
 
 			//Get Entity Tags
-			std::set<std::string> getEntityTags(Entity::Type entity);
+			std::set<std::string> const& getEntityTags(Entity::Type entity) const;
 
 			//Set Entity active State
 			void destroyEntity(Entity::Type entity);
@@ -242,8 +251,11 @@ namespace NIKE {
 			//Get first entity in list
 			Entity::Type getFirstEntity() const;
 
-			//Get entities by type
-			std::set<Entity::Type> getEntitiesByTag(std::string const& tag) const;
+			//Get entities by tag ( indexed, reference stays valid for lifetime of service )
+			std::set<Entity::Type> const& getEntitiesByTag(std::string const& tag) const;
+
+			//Get entities by interned tag handle ( "player"_sid )
+			std::set<Entity::Type> const& getEntitiesByTag(Utility::StringID tag_handle) const;
 
 			//Get entity metadata
 			std::optional<EntityData> getEntityDataCopy(Entity::Type entity) const;
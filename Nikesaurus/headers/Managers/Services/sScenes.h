@@ -48,6 +48,20 @@ namespace NIKE {
 
 			//Vector of entity in order
 			std::vector<Entity::Type> entities;
+
+			//Cached y sort key of entity
+			struct YSortKey {
+				Entity::Type entity;
+				float bottom;
+				size_t order;
+				bool b_transform;
+			};
+
+			//Y sort keys in current entity order ( Reused every frame )
+			std::vector<YSortKey> ysort_keys;
+
+			//Check if key a is drawn before key b
+			static bool isYSortedBefore(YSortKey const& a, YSortKey const& b);
 		public:
 			Layer() : b_state{ true }, id{ 0 } {}
 			~Layer() = default;
@@ -144,6 +158,9 @@ namespace NIKE {
 			//Layers within scene
 			std::vector<std::shared_ptr<Layer>> layers;
 
+			//Load current scene file ( Entity changes are batched )
+			void loadCurrScene();
+
 			//Init starting scene
 			void initScene(std::string const& scene_id);
 
@@ -187,6 +204,9 @@ namespace NIKE {
 			//Get all layers
 			std::vector<std::shared_ptr<Layer>>& getLayers();
 
+			//Mark entities of inactive layers ( Indexed by entity, lets systems iterate views instead of layers )
+			void markInactiveLayerEntities(std::vector<bool>& b_inactive) const;
+
 			//Queue scene event
 			void queueSceneEvent(Scenes::SceneEvent&& event);
 
@@ -31,6 +31,9 @@ namespace NIKE {
 			//Sprite animator
 			std::unique_ptr<Animation::SpriteAnimator> sprite_animator;
 
+			//Entities of inactive layers this frame ( Indexed by entity )
+			std::vector<bool> b_inactive_entities;
+
 		public:
 			//Default Constructor
 			Manager() = default;
@@ -26,7 +26,7 @@ namespace NIKE {
 		    Manager(Manager const& copy) = delete;
 		    void operator=(Manager const& copy) = delete;
 
-			std::unordered_map<Entity::Type, bool> statusEntities;
+			std::unordered_map<Entity::Handle, bool> statusEntities;
 
 			// Combat BGM (BGMC) control
 			void updateBGMCVolume();
@@ -19,7 +19,7 @@
 namespace NIKE {
     namespace Interaction {
 
-        static std::unordered_map<Entity::Type, bool> hitEntities;
+        static std::unordered_map<Entity::Handle, bool> hitEntities;
 
         static bool show_pause_menu;
 
@@ -0,0 +1,128 @@
+/*****************************************************************//**
+ * \file   sysBroadphase.h
+ * \brief  Uniform grid spatial hash broadphase for physics
+ *
+ * \author agent, agent@local (100%)
+ * \date   October 2026
+ * All content © 2026 DigiPen Institute of Technology Singapore, all rights reserved.
+ *********************************************************************/
+
+#pragma once
+
+#ifndef BROADPHASE_HPP
+#define BROADPHASE_HPP
+
+namespace NIKE {
+    namespace Broadphase {
+
+        // Colliders with an extent at or above this size skip the grid ( walls, boundaries )
+        constexpr float OVERSIZED_EXTENT = 1000.0f;
+
+        // Proxy mobility ( pairs are only reported when at least one side is awake )
+        enum class Mobility {
+            STATIC = 0,
+            SLEEPING,
+            AWAKE
+        };
+
+        //--------------------------------------------------------------------------
+        // Uniform grid spatial hash
+        //
+        // Each collider is a proxy covering a range of grid cells. Proxies are only
+        // re-bucketed when their cell range changes, so static props and resting
+        // bodies cost nothing to keep up to date. Oversized colliders are kept in a
+        // separate bucket and tested against proxies by bounds instead of filling
+        // the grid. Static and sleeping proxies never pair with each other, so a
+        // static proxy that is inserted or moved wakes the sleeping proxies it
+        // overlaps in wakeSleeping().
+        //--------------------------------------------------------------------------
+        class SpatialHash {
+        private:
+            // Broadphase proxy of an entity
+            struct Proxy {
+                Vector2f bounds_min;
+                Vector2f bounds_max;
+                Vector2i cell_min;
+                Vector2i cell_max;
+                uint32_t stamp;
+                Mobility mobility;
+                bool b_active;
+                bool b_oversized;
+                bool b_listed; // Entity is in active_entities ( kept when proxy is removed until endFrame prunes it )
+
+                Proxy() : bounds_min(), bounds_max(), cell_min(), cell_max(), stamp{ 0 }, mobility{ Mobility::STATIC }, b_active{ false }, b_oversized{ false }, b_listed{ false } {}
+            };
+
+            // Size of each grid cell
+            Vector2f cell_size;
+
+            // Proxies indexed by entity
+            std::vector<Proxy> proxies;
+
+            // Entities with an active proxy
+            std::vector<Entity::Type> active_entities;
+
+            // Oversized proxies ( not bucketed )
+            std::vector<Entity::Type> oversized_entities;
+
+            // Static proxies inserted or moved since the last wake pass
+            std::vector<Entity::Type> moved_static_entities;
+
+            // Grid buckets keyed by packed cell coordinates
+            std::unordered_map<uint64_t, std::vector<Entity::Type>> buckets;
+
+            // Current update stamp ( proxies not touched within a frame are pruned )
+            uint32_t curr_stamp;
+
+            // Pack cell coordinates into bucket key
+            static uint64_t cellKey(int x, int y);
+
+            // Convert world position to cell coordinates
+            Vector2i toCell(Vector2f const& position) const;
+
+            // Insert & remove proxy from its cell range
+            void insertIntoCells(Entity::Type entity);
+            void removeFromCells(Entity::Type entity);
+
+            // Remove proxy entirely
+            void removeProxy(Entity::Type entity);
+
+            // Check if proxy bounds overlap
+            static bool boundsOverlap(Proxy const& a, Proxy const& b);
+
+            // Check if pair needs narrowphase ( one side awake & bounds overlap )
+            bool isPotentialPair(Proxy const& a, Proxy const& b) const;
+
+        public:
+            // Default constructor
+            SpatialHash();
+
+            // Set cell size ( rebuckets every proxy when changed )
+            void setCellSize(Vector2f const& size);
+
+            // Begin broadphase frame
+            void beginFrame();
+
+            // Insert or update entity bounds
+            void updateProxy(Entity::Type entity, Vector2f const& bounds_min, Vector2f const& bounds_max, Mobility mobility);
+
+            // End broadphase frame, pruning proxies not updated since beginFrame
+            void endFrame();
+
+            // Wake sleeping proxies overlapping static proxies inserted or moved since last call ( woken entities are sorted )
+            void wakeSleeping(std::vector<Entity::Type>& woken);
+
+            // Gather unique potential pairs ( sorted, smaller ID first )
+            void queryPairs(std::vector<std::pair<Entity::Type, Entity::Type>>& pairs) const;
+
+            // Gather unique proxies near a box of half_extent moving from start to end ( sorted )
+            void querySegment(Vector2f const& start, Vector2f const& end, Vector2f const& half_extent, std::vector<Entity::Type>& entities) const;
+
+            // Remove all proxies
+            void clear();
+        };
+
+    } // namespace Broadphase
+} // namespace NIKE
+
+#endif //!BROADPHASE_HPP
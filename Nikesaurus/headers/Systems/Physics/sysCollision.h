@@ -26,6 +26,46 @@ namespace NIKE {
             CollisionInfo() : mtv(), collision_normal(), t_first{ 0.0f } {}
         };
 
+        // Max vertices of a SAT collider shape
+        constexpr int MAX_SAT_VERTICES = 4;
+
+        // Narrowphase data of a collider, computed once per physics step
+        struct ColliderCache {
+            Vector2f aabb_min;
+            Vector2f aabb_max;
+            std::array<Vector2f, MAX_SAT_VERTICES> vertices;   // Rotated world space vertices
+            std::array<Vector2f, MAX_SAT_VERTICES> axes;       // Normalized edge normals
+            int vertex_count;
+            bool b_axis_aligned;                                // Rotation is a multiple of 90
+
+            ColliderCache() : aabb_min(), aabb_max(), vertices(), axes(), vertex_count{ 0 }, b_axis_aligned{ true } {}
+        };
+
+        // Structure of arrays batch of AABB pair tests
+        struct AABBBatch {
+            // Pair A bounds
+            std::vector<float> a_min_x, a_min_y, a_max_x, a_max_y;
+
+            // Pair B bounds
+            std::vector<float> b_min_x, b_min_y, b_max_x, b_max_y;
+
+            // Relative velocity ( A - B )
+            std::vector<float> vel_x, vel_y;
+
+            // Results ( 0 = no collision, 1 = static overlap, 2 = swept collision )
+            std::vector<int> hit;
+            std::vector<float> t_first;
+
+            // Number of pairs ( arrays are padded to a multiple of 4 )
+            size_t count = 0;
+
+            // Clear batch ( keeps capacity )
+            void clear();
+
+            // Gather pair into batch
+            void push(ColliderCache const& a, Vector2f const& vel_a, ColliderCache const& b, Vector2f const& vel_b);
+        };
+
         // Collision System
         class System {
         private:
@@ -48,9 +88,7 @@ namespace NIKE {
                 CollisionInfo const& info);
 
             // SAT helper functions
-            std::vector<Vector2f> getRotatedVertices(const Physics::Collider& collider, const std::string& model_id);
-            std::vector<Vector2f> getSeparatingAxes(const std::vector<Vector2f>& verticesA, const std::vector<Vector2f>& verticesB);
-            void projectVerticesOnAxis(const std::vector<Vector2f>& vertices, const Vector2f& axis, float& min, float& max);
+            void projectVerticesOnAxis(ColliderCache const& cache, const Vector2f& axis, float& min, float& max);
 
             // Health drop collision check
             bool healthDropCollisionCheck(Entity::Type entity_a, Entity::Type entity_b);
@@ -80,14 +118,19 @@ namespace NIKE {
             // Get collision world restitution
             float getRestitution() const;
 
-            // AABB collision detection
-            bool detectAABBRectRect(Physics::Dynamics const& dynamics_a, Physics::Collider const& collider_a,
-                Physics::Dynamics const& dynamics_b, Physics::Collider const& collider_b,
-                CollisionInfo& info);
+            // SAT collision detection on cached colliders
+            bool detectSATCollision(ColliderCache const& cache_a, Vector2f const& position_a,
+                ColliderCache const& cache_b, Vector2f const& position_b, CollisionInfo& info);
 
-            // SAT collision detection
-            bool detectSATCollision(const Physics::Collider& colliderA, const Physics::Collider& colliderB,
-                const std::string& model_idA, const std::string& model_idB, CollisionInfo& info);
+            // Compute narrowphase cache of collider ( AABB, rotated vertices & axes )
+            void cacheCollider(const Physics::Collider& collider, const std::string& model_id, ColliderCache& cache);
+
+            // Run AABB tests ( static & swept ) for pairs [begin, end) of batch, 4 pairs at a time
+            // ( begin must be a multiple of 4, disjoint ranges may run on separate threads )
+            void detectAABBBatch(AABBBatch& batch, float delta_time, size_t begin, size_t end);
+
+            // Fill collision info of batched pair, returns false if pair did not collide
+            bool getAABBBatchResult(AABBBatch const& batch, size_t index, CollisionInfo& info) const;
 
             //Apply slide correction
             void applySlideCorrection(Physics::Dynamics& dynamics, const Vector2f& normal);
@@ -107,6 +150,9 @@ namespace NIKE {
 
             // Clear processed collisions
             void clearProcessedCollisions();
+
+            // Check if pair is allowed to collide ( health drop & faction rules )
+            bool shouldCollide(Entity::Type entity_a, Entity::Type entity_b);
         };
     }
 }
@@ -13,6 +13,7 @@
 #define PHYSICS_HPP
 
 #include "Systems/Physics/sysCollision.h"
+#include "Systems/Physics/sysBroadphase.h"
 #include "Managers/ECS/mSystem.h"
 #include "Components/cPhysics.h"
 #include "Managers/Services/sMap.h"
@@ -21,19 +22,34 @@ namespace NIKE {
     namespace Physics {
 
         //--------------------------------------------------------------------------
-        // NEW Multi-Cell Broad Phase with Hard-coded "Wall" collision hack
+        // Physics Manager
         //
-        // Instead of the old single-cell approach, we store the set of grid cells
-        // occupied by each entity. Then build potential collision pairs from any
-        // overlap in those cell sets. We add an extra hack: if an entity is named
-        // "left_wall","right_wall","top_wall","bottom_wall", we forcibly pair it
-        // with all other colliders.
+        // Integrates dynamics per fixed step, keeps each collider's bounds in a
+        // uniform grid spatial hash, then runs narrowphase on the unique pairs the
+        // broadphase reports.
         //
-        // The old single-cell approach is commented out at the bottom for reference.
+        // Colliders without dynamics ( or with zero max speed ) are static and are
+        // only refreshed on the first sub-step of a frame. Dynamic bodies that stay
+        // still for SLEEP_STEPS steps fall asleep until they gain velocity or force,
+        // are hit by an awake body, or a static collider ( e.g. a trigger pickup )
+        // spawns or moves over them.
+        //
+        // Collider AABBs, rotated vertices and SAT axes are cached once per step.
+        // Static & swept AABB tests for all pairs run as one batch before any
+        // resolution, using the velocities at the start of collision processing.
+        //
+        // Colliders flagged continuous are swept from their start-of-step position
+        // against the broadphase and stopped at the earliest time of impact, so
+        // fast bullets hit thin colliders without extra sub-steps.
+        //
+        // Integration and pair testing are split across the job service workers.
+        // Broadphase updates and collision resolution stay on the calling thread,
+        // with resolution running in sorted pair order for deterministic results.
         //--------------------------------------------------------------------------
         class Manager :
             public System::ISystem,
-            public Events::IEventListener<Physics::ChangePhysicsEvent>
+            public Events::IEventListener<Physics::ChangePhysicsEvent>,
+            public Events::IEventListener<Coordinator::EntitiesChanged>
         {
         private:
             // Delete Copy Constructor & Copy Assignment
@@ -43,23 +59,85 @@ namespace NIKE {
             // Collision sub system
             std::unique_ptr<Collision::System> collision_system;
 
-            // Map each entity to the set of grid cells it occupies
-            std::unordered_map<Entity::Type, std::vector<Vector2i>> entity_occupied_cells;
+            // Broadphase spatial hash
+            Broadphase::SpatialHash broadphase;
+
+            // Potential collision pairs ( reused across steps )
+            std::vector<std::pair<Entity::Type, Entity::Type>> potential_pairs;
+
+            // Consecutive still steps per entity ( sleeping once SLEEP_STEPS is reached, reset when entity is destroyed )
+            static constexpr uint16_t SLEEP_STEPS = 30;
+            std::vector<uint16_t> still_steps;
+
+            // Sleeping bodies woken by static proxies this step ( reused across steps )
+            std::vector<Entity::Type> woken_entities;
+
+            // Narrowphase collider cache per entity ( refreshed whenever the collider syncs )
+            std::vector<Collision::ColliderCache> collider_cache;
+
+            // Batched AABB tests of potential pairs ( reused across steps )
+            Collision::AABBBatch aabb_batch;
+
+            // Body simulated this step, gathered serially then integrated in parallel
+            struct StepBody {
+                Entity::Type entity;
+                Transform::Transform* transform;
+                Physics::Dynamics* dynamics;
+                Physics::Collider* collider;
+                const std::string* model_id;
+                Broadphase::Mobility mobility;
+                Vector2f start_position;
+            };
+            std::vector<StepBody> step_bodies;
+
+            // Entities of inactive layers this frame ( Indexed by entity )
+            std::vector<bool> b_inactive_entities;
+
+            // Narrowphase result of each potential pair ( one slot per pair, written by one job )
+            struct Contact {
+                Collision::CollisionInfo info;
+                bool b_detected = false;
+            };
+            std::vector<Contact> contacts;
+
+            // Time of impact contacts of continuous bodies ( resolved before regular pairs )
+            struct CCDContact {
+                Entity::Type entity_a;
+                Entity::Type entity_b;
+                Collision::CollisionInfo info;
+            };
+            std::vector<CCDContact> ccd_contacts;
+
+            // Broadphase candidates along a continuous body's path ( reused )
+            std::vector<Entity::Type> ccd_candidates;
+
+            // Job chunk sizes ( pair grain must stay a multiple of 4 for the AABB batch )
+            static constexpr size_t BODY_GRAIN = 64;
+            static constexpr size_t PAIR_GRAIN = 64;
+
+            // Classify entity mobility, waking sleeping bodies that gained motion
+            Broadphase::Mobility getMobility(Entity::Type entity, const Physics::Dynamics* dynamics);
 
             // Keep track of how many collision checks each entity does, for logging
             std::unordered_map<Entity::Type, int> collision_checks_count;
 
-            // Calculate which cells an entity occupies (plus a margin of 1 cell)
-            std::vector<Vector2i> calculateOccupiedCells(const Transform::Transform& transform);
+            // Get rotation aware bounds of collider
+            void getColliderBounds(const Physics::Collider& collider, Vector2f& bounds_min, Vector2f& bounds_max) const;
 
-            // Update one entity's physics (forces, velocity) and occupied cells
-            void updateEntityPhysics(Entity::Type entity, float dt);
+            // Sync collider transform to entity transform
+            void syncCollider(Physics::Collider& collider, const Transform::Transform& transform) const;
 
-            // Return potential collision pairs by checking overlap in cell sets
-            std::vector<std::pair<Entity::Type, Entity::Type>> getPotentialCollisions();
+            // Sweep continuous body from its start position, stopping it at the earliest time of impact
+            void sweepContinuousBody(StepBody const& body, float dt);
 
-            // Actually do collision detection/resolution for each pair
-            void processCollisions(const std::vector<std::pair<Entity::Type, Entity::Type>>& collision_pairs);
+            // Update an entity's broadphase proxy from its collider bounds
+            void updateBroadphaseProxy(Entity::Type entity, const Physics::Collider& collider, const Physics::Dynamics* dynamics, Broadphase::Mobility mobility, float dt);
+
+            // Update one entity's physics (forces, velocity) and collider cache ( safe to run in parallel across entities )
+            void updateEntityPhysics(StepBody const& body, float dt);
+
+            // Actually do collision detection/resolution for each pair ( AABB tests batched up front )
+            void processCollisions(const std::vector<std::pair<Entity::Type, Entity::Type>>& collision_pairs, float dt);
 
             //// OLD CODE: Single-cell approach - commented out
             //void applyXForce(Entity::Type entity, float force);
@@ -67,7 +145,7 @@ namespace NIKE {
 
         public:
             // Default Constructor
-            Manager() = default;
+            Manager() : still_steps(Entity::MAX, 0), collider_cache(Entity::MAX) {}
 
             // Default Destructor
             ~Manager() = default;
@@ -85,6 +163,9 @@ namespace NIKE {
 
             // On change physics event
             void onEvent(std::shared_ptr<Physics::ChangePhysicsEvent> event) override;
+
+            // On entities changed event ( recycled IDs start awake )
+            void onEvent(std::shared_ptr<Coordinator::EntitiesChanged> event) override;
         };
 
     } // namespace Physics
@@ -31,6 +31,19 @@ namespace NIKE {
 			//Delete Copy Constructor & Copy Assignment
 			Manager(Manager const& copy) = delete;
 			void operator=(Manager const& copy) = delete;
+
+			//Extra world units around camera view before entities are culled
+			static constexpr float CULL_MARGIN = 128.0f;
+
+			//Camera view rect in world space this frame
+			Vector2f view_min;
+			Vector2f view_max;
+
+			//Compute camera view rect for this frame
+			void updateCullView();
+
+			//Check if entity bounds lie outside camera view ( Child transform resolved to world space )
+			bool isCulled(Entity::Type entity) const;
 		public:
 
 
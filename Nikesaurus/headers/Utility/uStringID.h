@@ -0,0 +1,112 @@
+/*****************************************************************//**
+ * \file   uStringID.h
+ * \brief  Interned string IDs
+ *
+ * \author agent, agent@local (100%)
+ * \date   October 2026
+ * All content © 2026 DigiPen Institute of Technology Singapore, all rights reserved.
+ *********************************************************************/
+
+#pragma once
+
+#ifndef STRING_ID_HPP
+#define STRING_ID_HPP
+
+namespace NIKE {
+	namespace Utility {
+
+		//Temporary Disable DLL Export Warning
+		#pragma warning(disable: 4251)
+
+		//32 bit handle of an interned string
+		using StringID = uint32_t;
+
+		//FNV-1a hash, evaluated at compile time for literals
+		constexpr StringID hashString(const char* str, size_t size) {
+			StringID hash = 2166136261u;
+			for (size_t i = 0; i < size; ++i) {
+				hash ^= static_cast<StringID>(static_cast<unsigned char>(str[i]));
+				hash *= 16777619u;
+			}
+			return hash;
+		}
+
+		//Hash string view
+		constexpr StringID hashString(std::string_view str) {
+			return hashString(str.data(), str.size());
+		}
+
+		//Intern string into the global string table ( Throws if a different string already owns the handle )
+		NIKE_API StringID internString(std::string_view str);
+
+		//Get interned string from handle ( Throws if handle was never interned )
+		NIKE_API std::string const& getInternedString(StringID id);
+
+		//Check if handle has been interned
+		NIKE_API bool isStringInterned(StringID id);
+
+		/*****************************************************************//**
+		* Interned string
+		*********************************************************************/
+		class NIKE_API InternedString {
+		private:
+			//String kept for serialization and editor
+			std::string str;
+
+			//Cached handle
+			StringID id;
+
+		public:
+			//Constructors
+			InternedString() : str{ "" }, id{ hashString("", 0) } {}
+			explicit InternedString(std::string const& str) : str{ str }, id{ internString(str) } {}
+			explicit InternedString(const char* str) : str{ str }, id{ internString(this->str) } {}
+
+			//Assign string
+			InternedString& operator=(std::string const& other);
+			InternedString& operator=(const char* other);
+
+			//Get handle
+			StringID getID() const { return id; }
+
+			//Get string
+			std::string const& getString() const { return str; }
+			const char* c_str() const { return str.c_str(); }
+			bool empty() const { return str.empty(); }
+
+			//Implicit conversion for existing string interfaces
+			operator std::string const& () const { return str; }
+
+			//Handles are unique per string, comparisons do not touch the characters
+			friend bool operator==(InternedString const& lhs, InternedString const& rhs) { return lhs.id == rhs.id; }
+			friend bool operator!=(InternedString const& lhs, InternedString const& rhs) { return lhs.id != rhs.id; }
+			friend bool operator==(InternedString const& lhs, StringID rhs) { return lhs.id == rhs; }
+			friend bool operator!=(InternedString const& lhs, StringID rhs) { return lhs.id != rhs; }
+			friend bool operator==(InternedString const& lhs, std::string const& rhs) { return lhs.str == rhs; }
+			friend bool operator!=(InternedString const& lhs, std::string const& rhs) { return lhs.str != rhs; }
+			friend bool operator==(std::string const& lhs, InternedString const& rhs) { return lhs == rhs.str; }
+			friend bool operator!=(std::string const& lhs, InternedString const& rhs) { return lhs != rhs.str; }
+			friend bool operator==(InternedString const& lhs, const char* rhs) { return lhs.str == rhs; }
+			friend bool operator!=(InternedString const& lhs, const char* rhs) { return lhs.str != rhs; }
+			friend bool operator==(const char* lhs, InternedString const& rhs) { return lhs == rhs.str; }
+			friend bool operator!=(const char* lhs, InternedString const& rhs) { return lhs != rhs.str; }
+		};
+
+		//Serialize as plain string
+		inline void to_json(nlohmann::json& data, InternedString const& str) {
+			data = str.getString();
+		}
+
+		//Literal operator for compile time handles ( "texture.png"_sid )
+		namespace Literals {
+			constexpr StringID operator""_sid(const char* str, size_t size) {
+				return hashString(str, size);
+			}
+		}
+
+		//Re-enable DLL Export warning
+		#pragma warning(default: 4251)
+	}
+}
+
+#endif //!STRING_ID_HPP
@@ -95,7 +95,8 @@ namespace NIKE {
 						{ "Scale", comp.transform.scale.toJson()},
 						{ "Rotation", comp.transform.rotation},
 						{ "Pos_Offset", comp.pos_offset.toJson()},
-						{ "Resolution", static_cast<int>(comp.resolution) }
+						{ "Resolution", static_cast<int>(comp.resolution) },
+						{ "B_Continuous", comp.b_continuous }
 						};
 			},
 
@@ -107,6 +108,7 @@ namespace NIKE {
 				comp.transform.rotation = data.value("Rotation", 0.0f);
 				comp.pos_offset.fromJson(data.value("Pos_Offset", Vector2f::def_json));
 				comp.resolution = data.value("Resolution", Resolution::NONE);
+				comp.b_continuous = data.value("B_Continuous", false);
 			},
 
 			// Override Serialize
@@ -131,6 +133,9 @@ namespace NIKE {
 				if (comp.resolution != other_comp.resolution) {
 					delta["Resolution"] = static_cast<int>(comp.resolution);
 				}
+				if (comp.b_continuous != other_comp.b_continuous) {
+					delta["B_Continuous"] = comp.b_continuous;
+				}
 
 				return delta;
 			},
@@ -155,6 +160,9 @@ namespace NIKE {
 				if (delta.contains("Resolution")) {
 					comp.resolution = static_cast<Resolution>(delta["Resolution"]);
 				}
+				if (delta.contains("B_Continuous")) {
+					comp.b_continuous = delta["B_Continuous"];
+				}
 			}
 		);
 
@@ -479,6 +487,31 @@ namespace NIKE {
 					//Collision State
 					ImGui::Text("Colliding: %s", comp.b_collided ? "True" : "False");
 
+					//Edit continuous collision
+					{
+						ImGui::Text("Continuous Collision: ");
+						ImGui::SameLine();
+						ImGui::SmallButton(comp.b_continuous ? "Disable##ContinuousCollision" : "Enable##ContinuousCollision");
+
+						//Check if button has been activated
+						if (ImGui::IsItemActivated()) {
+							LevelEditor::Action set_continuous;
+
+							//Do set continuous
+							set_continuous.do_action = [&, continuous = !comp.b_continuous]() {
+								comp.b_continuous = continuous;
+								};
+
+							//Undo set continuous
+							set_continuous.undo_action = [&, continuous = comp.b_continuous]() {
+								comp.b_continuous = continuous;
+								};
+
+							//Execute action
+							NIKE_LVLEDITOR_SERVICE->executeAction(std::move(set_continuous));
+						}
+					}
+
 					//Collider resolution
 					ImGui::Text("Choose Collider Resolution:");
 					static const char* resolution_names[] = { "NONE", "SLIDE", "BOUNCE", "DESTROY" };
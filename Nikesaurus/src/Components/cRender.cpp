@@ -390,7 +390,7 @@ namespace NIKE {
 			// Override Deserialize
 			[](Render::Text& comp, nlohmann::json const& delta) {
 				if (delta.contains("Font_ID")) {
-					comp.font_id = delta["Font_ID"];
+					comp.font_id = delta["Font_ID"].get<std::string>();
 				}
 				if (delta.contains("Text")) {
 					comp.text = delta["Text"];
@@ -445,7 +445,7 @@ namespace NIKE {
 			// Override Deserialize
 			[](Render::Shape& comp, nlohmann::json const& delta) {
 				if (delta.contains("Model_ID")) {
-					comp.model_id = delta["Model_ID"];
+					comp.model_id = delta["Model_ID"].get<std::string>();
 				}
 				if (delta.contains("Color")) {
 					comp.color.fromJson(delta["Color"]);
@@ -518,7 +518,7 @@ namespace NIKE {
 			// Override Deserialize
 			[](Render::Texture& comp, nlohmann::json const& delta) {
 				if (delta.contains("Texture_ID")) {
-					comp.texture_id = delta["Texture_ID"];
+					comp.texture_id = delta["Texture_ID"].get<std::string>();
 				}
 				if (delta.contains("Color")) {
 					comp.color.fromJson(delta["Color"]);
@@ -105,11 +105,11 @@ namespace NIKE {
 						//Check for grid snapping
 						if (comp_panel.checkGridSnapping()) {
 							//Get snapped to cell position
-							auto cursor_cell = NIKE_MAP_SERVICE->getCellAtPosition(comp.position);
+							auto cursor_cell = NIKE_MAP_SERVICE->getCellIndexFromCords(comp.position);
 							if (cursor_cell.has_value()) {
 
 								//Snap to cell
-								comp.position = cursor_cell.value().get().position;
+								comp.position = NIKE_MAP_SERVICE->getCellPosition(cursor_cell.value());
 							}
 						}
 
@@ -166,6 +166,7 @@ namespace NIKE {
 		provideService(std::make_shared<Path::Service>());
 		provideService(std::make_shared<MetaData::Service>());
 		provideService(std::make_shared<StateMachine::Service>());
+		provideService(std::make_shared<Jobs::Service>());
 
 		//Create console
 #ifndef NDEBUG
@@ -226,12 +227,18 @@ namespace NIKE {
 		NIKE_EVENTS_SERVICE->addEventListeners<Input::MouseMovedEvent>(NIKE_UI_SERVICE);
 		NIKE_EVENTS_SERVICE->addEventListeners<Input::MouseMovedEvent>(NIKE_MAP_SERVICE);
 
+		//Add event listeners for entities changed
+		NIKE_EVENTS_SERVICE->addEventListeners<Coordinator::EntitiesChanged>(NIKE_MAP_SERVICE);
+
 		//Add event listeners for mouse scroll event
 		NIKE_EVENTS_SERVICE->addEventListeners<Input::MouseScrollEvent>(NIKE_INPUT_SERVICE);
 
 		//Init paths
 		NIKE_PATH_SERVICE->init(json_config);
 
+		//Init job workers
+		NIKE_JOBS_SERVICE->init();
+
 		//Init Audio
 		NIKE_AUDIO_SERVICE->init(json_config);
 
@@ -307,6 +314,9 @@ namespace NIKE {
 		//Update map grid
 		NIKE_MAP_SERVICE->gridUpdate();
 
+		//Solve queued path requests against settled grid
+		NIKE_MAP_SERVICE->updatePathRequests();
+
 		//Update all audio pending actions
 		NIKE_AUDIO_SERVICE->getAudioSystem()->update();
 
@@ -435,6 +445,9 @@ namespace NIKE {
 		NIKE_LVLEDITOR_SERVICE->cleanUp();
 #endif
 
+		//Stop job workers
+		NIKE_JOBS_SERVICE->shutdown();
+
 		//Clean up window resources
 		NIKE_WINDOWS_SERVICE->getWindow()->cleanUp();
 	}
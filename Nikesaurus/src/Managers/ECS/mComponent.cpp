@@ -14,84 +14,32 @@ namespace NIKE {
 	/*****************************************************************//**
 	* Component Service
 	*********************************************************************/
-	void Component::Manager::addDefEntityComponent(Entity::Type entity, Component::Type type) {
-		std::string component_string;
-		for (auto const& comp_type : component_types) {
-			if (comp_type.second == type) {
-				component_string = comp_type.first;
-				break;
-			}
+	Component::IArray* Component::Manager::getIArray(Component::Type type) const {
+		if (type >= Component::MAX || !component_arrays[type]) {
+			throw std::runtime_error("Component not registered.");
 		}
 
-		if (component_string == "") {
-			throw std::runtime_error("Component not registered. Adding new default component for entity failed.");
-		}
+		return component_arrays[type].get();
+	}
 
-		component_arrays.at(component_string)->createDefEntityComponent(entity);
+	void Component::Manager::addDefEntityComponent(Entity::Type entity, Component::Type type) {
+		getIArray(type)->createDefEntityComponent(entity);
 	}
 
 	void Component::Manager::removeEntityComponent(Entity::Type entity, Component::Type type) {
-		std::string component_string;
-		for (auto const& comp_type : component_types) {
-			if (comp_type.second == type) {
-				component_string = comp_type.first;
-				break;
-			}
-		}
-
-		if (component_string == "") {
-			throw std::runtime_error("Component not registered. Adding new default component for entity failed.");
-		}
-
-		component_arrays.at(component_string)->removeComponent(entity);
+		getIArray(type)->removeComponent(entity);
 	}
 
 	std::shared_ptr<void> Component::Manager::getEntityComponent(Entity::Type entity, Component::Type type) {
-		std::string component_string;
-		for (auto const& comp_type : component_types) {
-			if (comp_type.second == type) {
-				component_string = comp_type.first;
-				break;
-			}
-		}
-
-		if (component_string == "") {
-			throw std::runtime_error("Component not registered. Fetching component of entity failed.");
-		}
-
-		return component_arrays.at(component_string)->getEntityComponent(entity);
+		return getIArray(type)->getEntityComponent(entity);
 	}
 
 	std::shared_ptr<void> Component::Manager::getCopiedEntityComponent(Entity::Type entity, Component::Type type) {
-		std::string component_string;
-		for (auto const& comp_type : component_types) {
-			if (comp_type.second == type) {
-				component_string = comp_type.first;
-				break;
-			}
-		}
-
-		if (component_string == "") {
-			throw std::runtime_error("Component not registered. Fetching component of entity failed.");
-		}
-
-		return component_arrays.at(component_string)->getCopiedEntityComponent(entity);
+		return getIArray(type)->getCopiedEntityComponent(entity);
 	}
 
 	void Component::Manager::setEntityComponent(Entity::Type entity, Component::Type type, std::shared_ptr<void> comp) {
-		std::string component_string;
-		for (auto const& comp_type : component_types) {
-			if (comp_type.second == type) {
-				component_string = comp_type.first;
-				break;
-			}
-		}
-
-		if (component_string == "") {
-			throw std::runtime_error("Component not registered. Fetching component of entity failed.");
-		}
-
-		component_arrays[component_string]->setEntityComponent(entity, comp);
+		getIArray(type)->setEntityComponent(entity, comp);
 	}
 
 	Component::Type Component::Manager::getComponentType(std::string const& type) {
@@ -110,46 +58,22 @@ namespace NIKE {
 	}
 
 	size_t Component::Manager::getComponentEntitiesCount(Component::Type type) {
-		std::string component_string;
-		for (auto const& comp_type : component_types) {
-			if (comp_type.second == type) {
-				component_string = comp_type.first;
-				break;
-			}
-		}
-
-		if (component_string == "") {
-			throw std::runtime_error("Component not registered. Fetching component of entity failed.");
-		}
-
-		return component_arrays.at(component_string)->getComponentEntitiesCount();
+		return getIArray(type)->getComponentEntitiesCount();
 	}
 
 	std::set<Entity::Type> Component::Manager::getAllComponentEntities(Component::Type type) {
-		std::string component_string;
-		for (auto const& comp_type : component_types) {
-			if (comp_type.second == type) {
-				component_string = comp_type.first;
-				break;
-			}
-		}
-
-		if (component_string == "") {
-			throw std::runtime_error("Component not registered. Fetching component of entity failed.");
-		}
-
-		return component_arrays.at(component_string)->getComponentEntities();
+		return getIArray(type)->getComponentEntities();
 	}
 
 	void Component::Manager::cloneEntity(Entity::Type clone, Entity::Type copy) {
 		for (auto& c_array : component_arrays) {
-			c_array.second->cloneEntity(clone, copy);
+			if (c_array) c_array->cloneEntity(clone, copy);
 		}
 	}
 
 	void Component::Manager::entityDestroyed(Entity::Type entity) {
 		for (auto& c_array : component_arrays) {
-			c_array.second->entityDestroyed(entity);
+			if (c_array) c_array->entityDestroyed(entity);
 		}
 	}
 
@@ -157,9 +81,9 @@ namespace NIKE {
 		std::unordered_map<std::string, std::shared_ptr<void>> comp_map;
 
 		//Get all comp strings
-		for (auto const& comp : component_arrays) {
-			if (comp.second->checkEntity(entity)) {
-				comp_map.emplace(comp.first, comp.second->getEntityComponent(entity));
+		for (Component::Type type = 0; type < component_id; ++type) {
+			if (component_arrays[type] && component_arrays[type]->checkEntity(entity)) {
+				comp_map.emplace(component_names[type], component_arrays[type]->getEntityComponent(entity));
 			}
 		}
 
@@ -170,9 +94,9 @@ namespace NIKE {
 		std::unordered_map<std::string, std::shared_ptr<void>> comp_map;
 
 		//Get all comp strings
-		for (auto const& comp : component_arrays) {
-			if (comp.second->checkEntity(entity)) {
-				comp_map.emplace(comp.first, comp.second->getCopiedEntityComponent(entity));
+		for (Component::Type type = 0; type < component_id; ++type) {
+			if (component_arrays[type] && component_arrays[type]->checkEntity(entity)) {
+				comp_map.emplace(component_names[type], component_arrays[type]->getCopiedEntityComponent(entity));
 			}
 		}
 
@@ -17,16 +17,67 @@ namespace NIKE {
 	Coordinator::Manager::Manager()
 		: entity_manager{ std::make_unique<Entity::Manager>() },
 		component_manager{ std::make_unique<Component::Manager>() },
-		system_manager{ std::make_unique<System::Manager>() } {}
+		system_manager{ std::make_unique<System::Manager>() },
+		batch_depth{ 0 } {}
 
 	/*****************************************************************//**
 	* Entity Methods
 	*********************************************************************/
+	void Coordinator::Manager::dispatchEntitiesChanged() {
+		if (pending_added.empty() && pending_removed.empty())
+			return;
+
+		//Move pending deltas into event
+		auto event = std::make_shared<EntitiesChanged>(
+			std::vector<Entity::Type>(pending_added.begin(), pending_added.end()),
+			std::vector<Entity::Type>(pending_removed.begin(), pending_removed.end()));
+		pending_added.clear();
+		pending_removed.clear();
+
+		//Dispatch event
+		NIKE_EVENTS_SERVICE->dispatchEvent(event);
+	}
+
+	void Coordinator::Manager::beginBatch() {
+		++batch_depth;
+	}
+
+	void Coordinator::Manager::endBatch() {
+		if (batch_depth <= 0) {
+			throw std::runtime_error("endBatch called without matching beginBatch.");
+		}
+
+		if (--batch_depth == 0) {
+			dispatchEntitiesChanged();
+		}
+	}
+
+	Coordinator::BatchGuard Coordinator::Manager::batchEntityChanges() {
+		return BatchGuard(*this);
+	}
+
+	Coordinator::BatchGuard::BatchGuard(Manager& manager)
+		: manager{ manager }
+	{
+		manager.beginBatch();
+	}
+
+	Coordinator::BatchGuard::~BatchGuard() {
+		//Depth is restored before dispatch, so a throwing listener cannot leave the batch open
+		try {
+			manager.endBatch();
+		}
+		catch (std::exception const& e) {
+			NIKEE_CORE_ERROR("EntitiesChanged dispatch failed: {0}", e.what());
+		}
+	}
+
 	Entity::Type Coordinator::Manager::createEntity() {
 		auto entity = entity_manager->createEntity();
 
-		//Dispatch event
-		NIKE_EVENTS_SERVICE->dispatchEvent(std::make_shared<EntitiesChanged>(entity_manager->getAllEntities()));
+		//Record creation
+		pending_added.insert(entity);
+		if (batch_depth == 0) dispatchEntitiesChanged();
 
 		return entity;
 	}
@@ -37,33 +88,56 @@ namespace NIKE {
 		entity_manager->setSignature(new_entity, entity_manager->getSignature(copy));
 		system_manager->cloneEntity(new_entity, copy);
 
-		NIKE_EVENTS_SERVICE->dispatchEvent(std::make_shared<EntitiesChanged>(entity_manager->getAllEntities()));
+		//Record creation
+		pending_added.insert(new_entity);
+		if (batch_depth == 0) dispatchEntitiesChanged();
 
 		return new_entity;
 	}
 
 	void Coordinator::Manager::destroyEntity(Entity::Type entity) {
+		if (!entity_manager->checkEntity(entity))
+			return;
 
 		//Destroy all data related to entity
 		entity_manager->destroyEntity(entity);
 		component_manager->entityDestroyed(entity);
-		system_manager->entityDestroyed(entity); 
+		system_manager->entityDestroyed(entity);
+
+		//Entities created & destroyed within the same batch cancel out
+		if (pending_added.erase(entity) == 0) {
+			pending_removed.insert(entity);
+		}
+
+		if (batch_depth == 0) dispatchEntitiesChanged();
+	}
 
-		NIKE_EVENTS_SERVICE->dispatchEvent(std::make_shared<EntitiesChanged>(entity_manager->getAllEntities()));
+	void Coordinator::Manager::destroyEntities(std::vector<Entity::Type> const& entities) {
+		auto batch = batchEntityChanges();
+		for (auto entity : entities) {
+			destroyEntity(entity);
+		}
 	}
 
 	bool Coordinator::Manager::checkEntity(Entity::Type entity) const {
 		return entity_manager->checkEntity(entity);
 	}
 
+	Entity::Handle Coordinator::Manager::getEntityHandle(Entity::Type entity) const {
+		return entity_manager->getHandle(entity);
+	}
+
+	bool Coordinator::Manager::checkEntityHandle(Entity::Handle handle) const {
+		return entity_manager->checkHandle(handle);
+	}
+
 	int Coordinator::Manager::getEntityComponentCount(Entity::Type entity) const{
 		return entity_manager->getEntityComponentCount(entity);
 	}
 
 	void Coordinator::Manager::destroyAllEntities() {
-		for (auto entity : entity_manager->getAllEntities()) {
-			destroyEntity(entity);
-		}
+		auto all_entities = entity_manager->getAllEntities();
+		destroyEntities(std::vector<Entity::Type>(all_entities.begin(), all_entities.end()));
 	}
 
 	int Coordinator::Manager::getEntitiesCount() {
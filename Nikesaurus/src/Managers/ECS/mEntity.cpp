@@ -13,81 +13,109 @@
 
 
 namespace NIKE {
-	Entity::Manager::Manager() {
+	Entity::Manager::Manager()
+		: signatures(Entity::MAX), generations(Entity::MAX, 0), alive(Entity::MAX, 0),
+		avail_entities(Entity::MAX), avail_head{ 0 }, avail_count{ Entity::MAX }, entities_count{ 0 }
+	{
 		//Fill avail_entities with all possibles indexes up to the limit
 		for (Entity::Type i = 0; i < Entity::MAX; i++) {
-			avail_entities.push(i);
+			avail_entities[i] = i;
 		}
 	}
 
 	Entity::Type Entity::Manager::createEntity() {
 
 		//Check if entity has reached the max limit
-		if (avail_entities.empty()) {
+		if (avail_count == 0) {
 			throw std::runtime_error("Too many entities created.");
 		}
 
-		//Construct a new entity into entities map
-		Entity::Type id{ avail_entities.front() };
-		entities.emplace(std::piecewise_construct, std::forward_as_tuple(id), std::forward_as_tuple());
-		avail_entities.pop();
+		//Pop entity from front of ring
+		Entity::Type id{ avail_entities[avail_head] };
+		avail_head = (avail_head + 1) % Entity::MAX;
+		--avail_count;
+
+		//Activate entity slot
+		alive[id] = 1;
+		signatures[id].reset();
+		++entities_count;
 
 		return id;
 	}
 
 	void Entity::Manager::destroyEntity(Entity::Type entity) {
 		//Check if entity has alr been created
-		if (entities.find(entity) == entities.end()) {
+		if (!checkEntity(entity)) {
 			//throw std::runtime_error("Entity not found.");
 			return;
 		}
 
-		//Erase entity and push into avail entities
-		entities.erase(entity);
-		avail_entities.push(entity);
+		//Deactivate entity slot & invalidate outstanding handles
+		alive[entity] = 0;
+		signatures[entity].reset();
+		++generations[entity];
+		--entities_count;
+
+		//Push entity to back of ring
+		avail_entities[(avail_head + avail_count) % Entity::MAX] = entity;
+		++avail_count;
 	}
 
 	bool Entity::Manager::checkEntity(Entity::Type entity) const {
-		return entities.find(entity) != entities.end();
+		return entity < Entity::MAX && alive[entity];
+	}
+
+	Entity::Handle Entity::Manager::getHandle(Entity::Type entity) const {
+		//Check if entity has alr been created
+		if (!checkEntity(entity)) {
+			throw std::runtime_error("Entity not found.");
+		}
+
+		return Entity::makeHandle(entity, generations[entity]);
+	}
+
+	bool Entity::Manager::checkHandle(Entity::Handle handle) const {
+		Entity::Type entity = Entity::getHandleEntity(handle);
+		return checkEntity(entity) && generations[entity] == Entity::getHandleGeneration(handle);
 	}
 
 	void Entity::Manager::setSignature(Entity::Type entity, Component::Signature signature) {
 		//Check if entity has alr been created
-		if (entities.find(entity) == entities.end()) {
+		if (!checkEntity(entity)) {
 			throw std::runtime_error("Entity not found.");
 		}
 
 		//Set Signature
-		entities.at(entity) = signature;
+		signatures[entity] = signature;
 	}
 
 	Component::Signature const& Entity::Manager::getSignature(Entity::Type entity) const {
 		//Check if entity has alr been created
-		if (entities.find(entity) == entities.end()) {
+		if (!checkEntity(entity)) {
 			throw std::runtime_error("Entity not found.");
 		}
 
 		//Get Signature
-		return entities.at(entity);
+		return signatures[entity];
 	}
 
 	int Entity::Manager::getEntityComponentCount(Entity::Type entity) const {
 		//Check if entity has alr been created
-		if (entities.find(entity) == entities.end()) {
+		if (!checkEntity(entity)) {
 			throw std::runtime_error("Entity not found.");
 		}
 
-		return static_cast<int>(entities.at(entity).count());
+		return static_cast<int>(signatures[entity].count());
 	}
 
 	int Entity::Manager::getEntitiesCount() const {
-		return static_cast<int>(entities.size());
+		return entities_count;
 	}
 
 	std::set<Entity::Type> Entity::Manager::getAllEntities() const {
 		std::set<Entity::Type> return_vec;
-		for (auto const& entity : entities) {
-			return_vec.insert(entity.first);
+		for (Entity::Type entity = 0; entity < Entity::MAX; ++entity) {
+			if (alive[entity]) return_vec.insert(return_vec.end(), entity);
 		}
 		return return_vec;
 	}
@@ -164,6 +164,7 @@ namespace NIKE {
 			auto asset_id = getIDFromPath(path);
 			auto asset_type = getAssetType(NIKE_PATH_SERVICE->resolvePath(path));
 			asset_registry[asset_id] = MetaData(asset_type, NIKE_PATH_SERVICE->resolvePath(path));
+			Utility::internString(asset_id);
 
 			return asset_id;
 		}
@@ -175,6 +176,7 @@ namespace NIKE {
 			auto asset_id = getIDFromPath(path, false);
 			auto asset_type = getAssetType(std::filesystem::path(path));
 			asset_registry[asset_id] = MetaData(asset_type, path);
+			Utility::internString(asset_id);
 
 			return asset_id;
 		}
@@ -185,10 +187,16 @@ namespace NIKE {
 		//Check asset registry
 		auto register_it = asset_registry.find(asset_id);
 		if (register_it != asset_registry.end()) {
+			//Drop lua module built from script
+			if (register_it->second.type == Types::Script) {
+				NIKE_LUA_SERVICE->invalidateScriptModule(asset_id);
+			}
+
 			//Unregister
 			register_it = asset_registry.erase(register_it);
 			//Uncache
 			asset_cache.erase(asset_id);
+			handle_cache.erase(Utility::hashString(asset_id));
 		}
 	}
 
@@ -244,6 +252,14 @@ namespace NIKE {
 		if (cache_it != asset_cache.end()) {
 			cache_it = asset_cache.erase(cache_it);
 		}
+
+		//Drop lua module built from script ( Hot reload rebuilds it from the recached chunk )
+		if (getAssetType(asset_id) == Types::Script) {
+			NIKE_LUA_SERVICE->invalidateScriptModule(asset_id);
+		}
+
+		//Drop handle cache
+		handle_cache.erase(Utility::hashString(asset_id));
 	}
 
 	void Assets::Service::recacheAsset(std::string const& asset_id) {
@@ -260,6 +276,10 @@ namespace NIKE {
 		cacheAsset(asset_id);
 	}
 
+	unsigned int Assets::Service::getTextureAtlas() const {
+		return render_loader->getTextureAtlas();
+	}
+
 	void Assets::Service::getExecutable(std::string const& asset_id) {
 
 		//Check if asset is a executable asset type
@@ -456,6 +476,16 @@ namespace NIKE {
 		return asset_registry.find(asset_id) != asset_registry.end();
 	}
 
+	bool Assets::Service::isAssetRegistered(Utility::StringID asset_handle) const {
+
+		//Assets in handle cache are always registered
+		if (handle_cache.find(asset_handle) != handle_cache.end()) {
+			return true;
+		}
+
+		return Utility::isStringInterned(asset_handle) && isAssetRegistered(Utility::getInternedString(asset_handle));
+	}
+
 	std::string Assets::Service::getIDFromPath(std::string const& path, bool b_virtual) const {
 
 		if (b_virtual) {
@@ -481,6 +511,10 @@ namespace NIKE {
 	void Assets::Service::clearCache() {
 		//Clear asset cache when needed
 		asset_cache.clear();
+		handle_cache.clear();
+
+		//Drop lua modules built from cached scripts
+		NIKE_LUA_SERVICE->invalidateScriptModules();
 	}
 
 	void Assets::Service::scanAssetDirectory(std::string const& virtual_path, bool b_diretory_tree) {
@@ -643,6 +677,7 @@ namespace NIKE {
 		//Deserialize registry meta data
 		for (const auto& [id, meta_data] : data.items()) {
 			asset_registry[id] = MetaData(static_cast<Types>(meta_data["Type"].get<int>()), meta_data["Primary_Path"].get<std::string>());
+			Utility::internString(id);
 		}
 	}
 
@@ -0,0 +1,165 @@
+/*****************************************************************//**
+ * \file   sAtlasPacker.cpp
+ * \brief  Skyline rect packer for runtime texture atlases
+ *
+ * \author agent, agent@local (100%)
+ * \date   October 2026
+ * All content © 2026 DigiPen Institute of Technology Singapore, all rights reserved.
+ *********************************************************************/
+
+#include "Core/stdafx.h"
+#include "Managers/Services/Assets/sAtlasPacker.h"
+
+namespace NIKE {
+
+	Assets::AtlasPacker::AtlasPacker(Vector2i const& layer_size, int max_layers, int padding)
+		: layer_size{ layer_size }, max_layers{ max_layers }, padding{ padding }
+	{
+		if (layer_size.x <= 0 || layer_size.y <= 0 || max_layers <= 0 || padding < 0) {
+			throw std::runtime_error("Invalid atlas packer dimensions.");
+		}
+	}
+
+	int Assets::AtlasPacker::fitSkyline(std::vector<SkylineNode> const& skyline, size_t index, int width, int height) const {
+		const int x = skyline[index].x;
+		if (x + width > layer_size.x) {
+			return -1;
+		}
+
+		//Rect rests on the highest node it spans
+		int y = skyline[index].y;
+		int width_left = width;
+		for (size_t i = index; width_left > 0; ++i) {
+			if (i >= skyline.size()) {
+				return -1;
+			}
+
+			y = std::max(y, skyline[i].y);
+			if (y + height > layer_size.y) {
+				return -1;
+			}
+
+			width_left -= skyline[i].width;
+		}
+
+		return y;
+	}
+
+	void Assets::AtlasPacker::addSkylineLevel(std::vector<SkylineNode>& skyline, size_t index, int x, int y, int width, int height) {
+		skyline.insert(skyline.begin() + index, SkylineNode{ x, y + height, width });
+
+		//Trim nodes covered by the new node
+		for (size_t i = index + 1; i < skyline.size(); ++i) {
+			const int prev_end = skyline[i - 1].x + skyline[i - 1].width;
+			if (skyline[i].x >= prev_end) {
+				break;
+			}
+
+			const int shrink = prev_end - skyline[i].x;
+			skyline[i].x += shrink;
+			skyline[i].width -= shrink;
+
+			if (skyline[i].width > 0) {
+				break;
+			}
+
+			skyline.erase(skyline.begin() + i);
+			--i;
+		}
+
+		//Merge neighbouring nodes at the same height
+		for (size_t i = 0; i + 1 < skyline.size();) {
+			if (skyline[i].y == skyline[i + 1].y) {
+				skyline[i].width += skyline[i + 1].width;
+				skyline.erase(skyline.begin() + i + 1);
+			}
+			else {
+				++i;
+			}
+		}
+	}
+
+	bool Assets::AtlasPacker::pack(Vector2i const& size, AtlasRegion& region) {
+		const int width = size.x + padding * 2;
+		const int height = size.y + padding * 2;
+
+		if (size.x <= 0 || size.y <= 0 || width > layer_size.x || height > layer_size.y) {
+			return false;
+		}
+
+		for (int layer = 0; layer < max_layers; ++layer) {
+
+			//Open new layer
+			if (layer == static_cast<int>(skylines.size())) {
+				skylines.push_back({ SkylineNode{ 0, 0, layer_size.x } });
+			}
+
+			auto& skyline = skylines[layer];
+
+			//Bottom left heuristic ( Lowest top edge, then leftmost )
+			int best_top = std::numeric_limits<int>::max();
+			int best_x = 0;
+			int best_y = 0;
+			size_t best_index = skyline.size();
+			for (size_t i = 0; i < skyline.size(); ++i) {
+				const int y = fitSkyline(skyline, i, width, height);
+				if (y < 0) {
+					continue;
+				}
+
+				if (y + height < best_top || (y + height == best_top && skyline[i].x < best_x)) {
+					best_top = y + height;
+					best_x = skyline[i].x;
+					best_y = y;
+					best_index = i;
+				}
+			}
+
+			if (best_index == skyline.size()) {
+				continue;
+			}
+
+			addSkylineLevel(skyline, best_index, best_x, best_y, width, height);
+
+			region.layer = layer;
+			region.pos = { best_x + padding, best_y + padding };
+			region.size = size;
+			return true;
+		}
+
+		return false;
+	}
+
+	void Assets::AtlasPacker::reset() {
+		skylines.clear();
+	}
+
+	int Assets::AtlasPacker::getLayerCount() const {
+		return static_cast<int>(skylines.size());
+	}
+
+	Vector2i Assets::AtlasPacker::getLayerSize() const {
+		return layer_size;
+	}
+
+	int Assets::AtlasPacker::getPadding() const {
+		return padding;
+	}
+
+	std::vector<unsigned char> Assets::AtlasPacker::extrudeImage(const unsigned char* rgba, Vector2i const& size, int padding) {
+		static constexpr int CHANNELS = 4;
+		const int width = size.x + padding * 2;
+		const int height = size.y + padding * 2;
+
+		std::vector<unsigned char> padded(static_cast<size_t>(width) * height * CHANNELS);
+		for (int y = 0; y < height; ++y) {
+			const int src_y = std::clamp(y - padding, 0, size.y - 1);
+			for (int x = 0; x < width; ++x) {
+				const int src_x = std::clamp(x - padding, 0, size.x - 1);
+				std::copy_n(rgba + (static_cast<size_t>(src_y) * size.x + src_x) * CHANNELS, CHANNELS, padded.data() + (static_cast<size_t>(y) * width + x) * CHANNELS);
+			}
+		}
+
+		return padded;
+	}
+}
@@ -226,7 +226,7 @@ namespace NIKE {
 		}
 	} 
 
-	void Assets::RenderLoader::createBatchedBaseBuffers(Model& model) {
+	void Assets::RenderLoader::createBatchedBaseBuffers(Model& model, const std::vector<unsigned int>& indices) {
 		// only handles drwaing quads
 
 		GLenum err = glGetError();
@@ -249,17 +249,9 @@ namespace NIKE {
 		glVertexArrayVertexBuffer(model.vaoid, VBO_BINDING_INDEX, model.vboid, 0, VERTEX_SIZE);
 		glVertexArrayElementBuffer(model.vaoid, model.eboid);
 
-
-		// allocate space for vbo
-		static constexpr int NUM_VERTEX_PER_INSTANCE = 4;
-		static const int MAX_VBO_SIZE = NIKE_RENDER_SERVICE->MAX_INSTANCES * NUM_VERTEX_PER_INSTANCE * VERTEX_SIZE;
-		glNamedBufferStorage(model.vboid, MAX_VBO_SIZE, nullptr, GL_DYNAMIC_STORAGE_BIT);
-
-		// allocate space for ebo
-		static constexpr int NUM_INDICES_PER_INSTANCE = 6;
-		static constexpr int INDEX_SIZE = sizeof(unsigned int);
-		static const int MAX_EBO_SIZE = NIKE_RENDER_SERVICE->MAX_INSTANCES * NUM_INDICES_PER_INSTANCE * INDEX_SIZE;
-		glNamedBufferStorage(model.eboid, MAX_EBO_SIZE, nullptr, GL_DYNAMIC_STORAGE_BIT);
+		// static quad shared by every instance, per instance data comes from the render service instance ring
+		glNamedBufferStorage(model.vboid, model.vertices.size() * VERTEX_SIZE, model.vertices.data(), 0);
+		glNamedBufferStorage(model.eboid, indices.size() * sizeof(unsigned int), indices.data(), 0);
 
 		// set vertex array attributes
 
@@ -278,65 +270,8 @@ namespace NIKE {
 		);
 		glVertexArrayAttribBinding(model.vaoid, POSITION_ATTRIB_INDEX, VBO_BINDING_INDEX);
 
-		// batched_base.vert location=1
-		static constexpr int COLOR_ATTRIB_INDEX = 1;
-		static constexpr int COLOR_ATTRIB_SIZE = 4;		// num elements (r,g,b,a)
-		static constexpr int COLOR_DATA_TYPE = GL_FLOAT;
-		static constexpr int COLOR_DATA_OFFSET = offsetof(Vertex, col);
-		glEnableVertexArrayAttrib(model.vaoid, COLOR_ATTRIB_INDEX);		// vertex attrib index 1
-		glVertexArrayAttribFormat(
-			model.vaoid,
-			COLOR_ATTRIB_INDEX,
-			COLOR_ATTRIB_SIZE,
-			COLOR_DATA_TYPE,
-			false,		//normalized
-			COLOR_DATA_OFFSET		// offset
-		);
-		glVertexArrayAttribBinding(model.vaoid, COLOR_ATTRIB_INDEX, VBO_BINDING_INDEX);
-
-		// batched_base.vert location=4
-		static constexpr int XFORM_ATTRIB_INDEX_0 = 4;
-		static constexpr int XFORM_ATTRIB_SIZE = 3;		// num elements(row of 3x3 mtx)
-		static constexpr int XFORM_DATA_TYPE = GL_FLOAT;
-		static constexpr int XFORM_DATA_OFFSET_0 = offsetof(Vertex, transform);
-		glEnableVertexArrayAttrib(model.vaoid, XFORM_ATTRIB_INDEX_0);		// vertex attrib index 4
-		glVertexArrayAttribFormat(
-			model.vaoid,
-			XFORM_ATTRIB_INDEX_0,
-			XFORM_ATTRIB_SIZE,
-			XFORM_DATA_TYPE,
-			false,		//normalized
-			XFORM_DATA_OFFSET_0		// offset
-		);
-		glVertexArrayAttribBinding(model.vaoid, XFORM_ATTRIB_INDEX_0, VBO_BINDING_INDEX);
-
-		static constexpr int XFORM_ATTRIB_INDEX_1 = 5;
-		static constexpr int XFORM_DATA_OFFSET_1 = XFORM_DATA_OFFSET_0 + sizeof(std::array<float, 3>);
-		glEnableVertexArrayAttrib(model.vaoid, XFORM_ATTRIB_INDEX_1);		// vertex attrib index 5
-		glVertexArrayAttribFormat(
-			model.vaoid,
-			XFORM_ATTRIB_INDEX_1,
-			XFORM_ATTRIB_SIZE,
-			XFORM_DATA_TYPE,
-			false,		//normalized
-			XFORM_DATA_OFFSET_1		// offset
-		);
-		glVertexArrayAttribBinding(model.vaoid, XFORM_ATTRIB_INDEX_1, VBO_BINDING_INDEX);
-
-		static constexpr int XFORM_ATTRIB_INDEX_2 = 6;
-		static constexpr int XFORM_DATA_OFFSET_2 = XFORM_DATA_OFFSET_1 + sizeof(std::array<float, 3>);
-		glEnableVertexArrayAttrib(model.vaoid, XFORM_ATTRIB_INDEX_2);		// vertex attrib index 6
-		glVertexArrayAttribFormat(
-			model.vaoid,
-			XFORM_ATTRIB_INDEX_2,
-			XFORM_ATTRIB_SIZE,
-			XFORM_DATA_TYPE,
-			false,		//normalized
-			XFORM_DATA_OFFSET_2		// offset
-		);
-		glVertexArrayAttribBinding(model.vaoid, XFORM_ATTRIB_INDEX_2, VBO_BINDING_INDEX);
-
-		// vbo and ebo data population will be done in update
+		// batched_base.vert per instance attributes (transform, color)
+		Render::InstanceRing::setupAttributes(model.vaoid);
 
 		err = glGetError();
 		if (err != GL_NO_ERROR) {
@@ -344,7 +279,7 @@ namespace NIKE {
 		}
 	}
 
-	void Assets::RenderLoader::createBatchedTextureBuffers(Model& model) {
+	void Assets::RenderLoader::createBatchedTextureBuffers(Model& model, const std::vector<unsigned int>& indices) {
 
 		GLenum err = glGetError();
 		if (err != GL_NO_ERROR) {
@@ -353,22 +288,6 @@ namespace NIKE {
 
 		while (glGetError() != GL_NO_ERROR) {}
 
-		// !NOTE: n.loo
-		//glFinish();
-		//GLint maxVertexAttribs;
-
-		//glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &maxVertexAttribs);
-		//if (13 >= maxVertexAttribs) {  // 13 might be too high
-		//	NIKEE_CORE_ERROR("Attribute index {0} exceeds maximum supported attributes: {1}",
-		//		13, maxVertexAttribs);
-		//	return;
-		//}
-
-		//GLint previousVAO, previousVBO;
-		//glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &previousVAO);
-		//glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &previousVBO);
-
-
 		// create vao
 		glCreateVertexArrays(1, &model.vaoid);
 
@@ -384,17 +303,9 @@ namespace NIKE {
 		glVertexArrayVertexBuffer(model.vaoid, VBO_BINDING_INDEX, model.vboid, 0, VERTEX_SIZE);
 		glVertexArrayElementBuffer(model.vaoid, model.eboid);
 
-
-		// allocate space for vbo
-		static constexpr int NUM_VERTEX_PER_INSTANCE = 4;
-		static const int MAX_VBO_SIZE = NIKE_RENDER_SERVICE->MAX_INSTANCES * NUM_VERTEX_PER_INSTANCE * VERTEX_SIZE;
-		glNamedBufferStorage(model.vboid, MAX_VBO_SIZE, nullptr, GL_DYNAMIC_STORAGE_BIT);
-
-		// allocate space for ebo
-		static constexpr int NUM_INDICES_PER_INSTANCE = 6;
-		static constexpr int INDEX_SIZE = sizeof(unsigned int);
-		static const int MAX_EBO_SIZE = NIKE_RENDER_SERVICE->MAX_INSTANCES * NUM_INDICES_PER_INSTANCE * INDEX_SIZE;
-		glNamedBufferStorage(model.eboid, MAX_EBO_SIZE, nullptr, GL_DYNAMIC_STORAGE_BIT);
+		// static quad shared by every instance, per instance data comes from the render service instance ring
+		glNamedBufferStorage(model.vboid, model.vertices.size() * VERTEX_SIZE, model.vertices.data(), 0);
+		glNamedBufferStorage(model.eboid, indices.size() * sizeof(unsigned int), indices.data(), 0);
 
 		// set vertex array attributes
 
@@ -429,155 +340,13 @@ namespace NIKE {
 		);
 		glVertexArrayAttribBinding(model.vaoid, TEXCOORD_ATTRIB_INDEX, VBO_BINDING_INDEX);
 
-		// batched_texture.vert location=2
-		static constexpr int SAMPLERIDX_ATTRIB_INDEX = 2;
-		static constexpr int SAMPLERIDX_ATTRIB_SIZE = 1;		// num elements (index)
-		static constexpr int SAMPLERIDX_DATA_TYPE = GL_FLOAT;
-		static constexpr int SAMPLERIDX_DATA_OFFSET = offsetof(Vertex, sampler_idx);
-		glEnableVertexArrayAttrib(model.vaoid, SAMPLERIDX_ATTRIB_INDEX);		// vertex attrib index 1
-		glVertexArrayAttribFormat(
-			model.vaoid,
-			SAMPLERIDX_ATTRIB_INDEX,
-			SAMPLERIDX_ATTRIB_SIZE,
-			SAMPLERIDX_DATA_TYPE,
-			false,		//normalized
-			SAMPLERIDX_DATA_OFFSET		// offset
-		);
-		glVertexArrayAttribBinding(model.vaoid, SAMPLERIDX_ATTRIB_INDEX, VBO_BINDING_INDEX);
-		// glVertexAttribDivisor(SAMPLERIDX_ATTRIB_INDEX, 1);		// per instance only. do not interpolate(nvm useless)
-
-		// batched_texture.vert location=4
-		static constexpr int XFORM_ATTRIB_INDEX_0 = 4;
-		static constexpr int XFORM_ATTRIB_SIZE = 3;		// num elements(row of 3x3 mtx)
-		static constexpr int XFORM_DATA_TYPE = GL_FLOAT;
-		static constexpr int XFORM_DATA_OFFSET_0 = offsetof(Vertex, transform);
-		glEnableVertexArrayAttrib(model.vaoid, XFORM_ATTRIB_INDEX_0);		// vertex attrib index 4
-		glVertexArrayAttribFormat(
-			model.vaoid,
-			XFORM_ATTRIB_INDEX_0,
-			XFORM_ATTRIB_SIZE,
-			XFORM_DATA_TYPE,
-			false,		//normalized
-			XFORM_DATA_OFFSET_0		// offset
-		);
-		glVertexArrayAttribBinding(model.vaoid, XFORM_ATTRIB_INDEX_0, VBO_BINDING_INDEX);
-
-		static constexpr int XFORM_ATTRIB_INDEX_1 = 5;
-		static constexpr int XFORM_DATA_OFFSET_1 = XFORM_DATA_OFFSET_0 + sizeof(std::array<float, 3>);
-		glEnableVertexArrayAttrib(model.vaoid, XFORM_ATTRIB_INDEX_1);		// vertex attrib index 5
-		glVertexArrayAttribFormat(
-			model.vaoid,
-			XFORM_ATTRIB_INDEX_1,
-			XFORM_ATTRIB_SIZE,
-			XFORM_DATA_TYPE,
-			false,		//normalized
-			XFORM_DATA_OFFSET_1		// offset
-		);
-		glVertexArrayAttribBinding(model.vaoid, XFORM_ATTRIB_INDEX_1, VBO_BINDING_INDEX);
-
-		static constexpr int XFORM_ATTRIB_INDEX_2 = 6;
-		static constexpr int XFORM_DATA_OFFSET_2 = XFORM_DATA_OFFSET_1 + sizeof(std::array<float, 3>);
-		glEnableVertexArrayAttrib(model.vaoid, XFORM_ATTRIB_INDEX_2);		// vertex attrib index 6
-		glVertexArrayAttribFormat(
-			model.vaoid,
-			XFORM_ATTRIB_INDEX_2,
-			XFORM_ATTRIB_SIZE,
-			XFORM_DATA_TYPE,
-			false,		//normalized
-			XFORM_DATA_OFFSET_2		// offset
-		);
-		glVertexArrayAttribBinding(model.vaoid, XFORM_ATTRIB_INDEX_2, VBO_BINDING_INDEX);
-
-		// batched_texture.vert location=8
-		static constexpr int FRAMESIZE_ATTRIB_INDEX = 8;
-		static constexpr int FRAMESIZE_ATTRIB_SIZE = 2;		// num elements (x, y)
-		static constexpr int FRAMESIZE_DATA_TYPE = GL_FLOAT;
-		static constexpr int FRAMESIZE_DATA_OFFSET = offsetof(Vertex, framesize);
-		glEnableVertexArrayAttrib(model.vaoid, FRAMESIZE_ATTRIB_INDEX);		// vertex attrib index 1
-		glVertexArrayAttribFormat(
-			model.vaoid,
-			FRAMESIZE_ATTRIB_INDEX,
-			FRAMESIZE_ATTRIB_SIZE,
-			FRAMESIZE_DATA_TYPE,
-			false,		//normalized
-			FRAMESIZE_DATA_OFFSET		// offset
-		);
-		glVertexArrayAttribBinding(model.vaoid, FRAMESIZE_ATTRIB_INDEX, VBO_BINDING_INDEX);
-
-		// batched_texture.vert location=9
-		static constexpr int UVOFFSET_ATTRIB_INDEX = 9;
-		static constexpr int UVOFFSET_ATTRIB_SIZE = 2;		// num elements (x, y)
-		static constexpr int UVOFFSET_DATA_TYPE = GL_FLOAT;
-		static constexpr int UVOFFSET_DATA_OFFSET = offsetof(Vertex, uv_offset);
-		glEnableVertexArrayAttrib(model.vaoid, UVOFFSET_ATTRIB_INDEX);		// vertex attrib index 1
-		glVertexArrayAttribFormat(
-			model.vaoid,
-			UVOFFSET_ATTRIB_INDEX,
-			UVOFFSET_ATTRIB_SIZE,
-			UVOFFSET_DATA_TYPE,
-			false,		//normalized
-			UVOFFSET_DATA_OFFSET		// offset
-		);
-		glVertexArrayAttribBinding(model.vaoid, UVOFFSET_ATTRIB_INDEX, VBO_BINDING_INDEX);
-
-		// batched_texture.vert location=11
-		static constexpr int BLEND_ATTRIB_INDEX = 11;
-		static constexpr int BLEND_ATTRIB_SIZE = 1;		// num elements (x, y)
-		static constexpr int BLEND_DATA_TYPE = GL_FLOAT;
-		static constexpr int BLEND_DATA_OFFSET = offsetof(Vertex, to_blend_color);
-		glEnableVertexArrayAttrib(model.vaoid, BLEND_ATTRIB_INDEX);		// vertex attrib index 1
-		glVertexArrayAttribFormat(
-			model.vaoid,
-			BLEND_ATTRIB_INDEX,
-			BLEND_ATTRIB_SIZE,
-			BLEND_DATA_TYPE,
-			false,		//normalized
-			BLEND_DATA_OFFSET		// offset
-		);
-		glVertexArrayAttribBinding(model.vaoid, BLEND_ATTRIB_INDEX, VBO_BINDING_INDEX);
-
-		// batched_texture.vert location=12
-		static constexpr int BLENDCOLOR_ATTRIB_INDEX = 12;
-		static constexpr int BLENDCOLOR_ATTRIB_SIZE = 4;		// num elements (x, y)
-		static constexpr int BLENDCOLOR_DATA_TYPE = GL_FLOAT;
-		static constexpr int BLENDCOLOR_DATA_OFFSET = offsetof(Vertex, col);
-		glEnableVertexArrayAttrib(model.vaoid, BLENDCOLOR_ATTRIB_INDEX);		// vertex attrib index 1
-		glVertexArrayAttribFormat(
-			model.vaoid,
-			BLENDCOLOR_ATTRIB_INDEX,
-			BLENDCOLOR_ATTRIB_SIZE,
-			BLENDCOLOR_DATA_TYPE,
-			false,		//normalized
-			BLENDCOLOR_DATA_OFFSET		// offset
-		);
-		glVertexArrayAttribBinding(model.vaoid, BLENDCOLOR_ATTRIB_INDEX, VBO_BINDING_INDEX);
-
-		// batched_texture.vert location=13
-		static constexpr int BLENDINTENSITY_ATTRIB_INDEX = 13;
-		static constexpr int BLENDINTENSITY_ATTRIB_SIZE = 1;		// num elements (x, y)
-		static constexpr int BLENDINTENSITY_DATA_TYPE = GL_FLOAT;
-		static constexpr int BLENDINTENSITY_DATA_OFFSET = offsetof(Vertex, blend_intensity);
-		glEnableVertexArrayAttrib(model.vaoid, BLENDINTENSITY_ATTRIB_INDEX);		// vertex attrib index 1
-		glVertexArrayAttribFormat(
-			model.vaoid,
-			BLENDINTENSITY_ATTRIB_INDEX,
-			BLENDINTENSITY_ATTRIB_SIZE,
-			BLENDINTENSITY_DATA_TYPE,
-			false,		//normalized
-			BLENDINTENSITY_DATA_OFFSET		// offset
-		);
-		glVertexArrayAttribBinding(model.vaoid, BLENDINTENSITY_ATTRIB_INDEX, VBO_BINDING_INDEX);
-
-		// vbo and ebo data population will be done in update
+		// batched_texture.vert per instance attributes (transform, framesize, uv offset, sampler index, blend)
+		Render::InstanceRing::setupAttributes(model.vaoid);
 
 		err = glGetError();
 		if (err != GL_NO_ERROR) {
 			NIKEE_CORE_ERROR("OpenGL error at end of {0}: {1}", __FUNCTION__, err);
 		}
-
-		// !NOTE: n.loo
-		//glBindVertexArray(previousVAO);
-		//glBindBuffer(GL_ARRAY_BUFFER, previousVBO);
 	}
 
 	void Assets::RenderLoader::createTextureBuffers(const std::vector<Vector2f>& vertices, const std::vector<unsigned int>& indices, const std::vector<Vector2f>& tex_coords, Assets::Model& model) {
@@ -806,7 +575,7 @@ namespace NIKE {
 
 		if (tex_coords.size() == 0) {
 			if (for_batched_rendering) {
-				createBatchedBaseBuffers(model);
+				createBatchedBaseBuffers(model, indices);
 			}
 			else {
 				createBaseBuffers(pos_vertices, indices, model);
@@ -814,7 +583,7 @@ namespace NIKE {
 		}
 		else {
 			if (for_batched_rendering) {
-				createBatchedTextureBuffers(model);
+				createBatchedTextureBuffers(model, indices);
 			}
 			else {
 				createTextureBuffers(pos_vertices, indices, tex_coords, model);
@@ -851,12 +620,56 @@ namespace NIKE {
 		glTextureStorage2D(tex_id, 1, GL_RGBA8, tex_width, tex_height);
 		glTextureSubImage2D(tex_id, 0, 0, 0, tex_width, tex_height, (is_tex_or_png_ext ? GL_RGBA : GL_RGB), GL_UNSIGNED_BYTE, tex_data);
 
+		Assets::Texture texture(tex_id, { tex_width, tex_height }, path_to_texture);
+
+		// pack into atlas so batched sprites do not use up sampler slots
+		if (is_tex_or_png_ext) {
+			addToTextureAtlas(tex_data, texture);
+		}
+
 		stbi_image_free(static_cast<unsigned char*>(const_cast<void*>(reinterpret_cast<const void*>(tex_data))));
 
 		NIKEE_CORE_INFO("Sucessfully loaded texture from " + path_to_texture);
 
 		// Return texture
-		return Assets::Texture(tex_id, { tex_width, tex_height }, path_to_texture);
+		return texture;
+	}
+
+	void Assets::RenderLoader::addToTextureAtlas(const unsigned char* tex_data, Texture& texture) {
+		if (texture.size.x > ATLAS_MAX_ENTRY_SIZE || texture.size.y > ATLAS_MAX_ENTRY_SIZE) {
+			return;
+		}
+
+		AtlasRegion region;
+		if (!atlas_packer.pack(texture.size, region)) {
+			NIKEE_CORE_WARN("Texture atlas full, {} is rendered from its own texture", texture.file_path);
+			return;
+		}
+
+		// create atlas on first use, layers are allocated up front as array storage is immutable
+		if (atlas_texture == 0) {
+			glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &atlas_texture);
+			glTextureStorage3D(atlas_texture, 1, GL_RGBA8, ATLAS_LAYER_SIZE, ATLAS_LAYER_SIZE, ATLAS_MAX_LAYERS);
+			glTextureParameteri(atlas_texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTextureParameteri(atlas_texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTextureParameteri(atlas_texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTextureParameteri(atlas_texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		}
+
+		// upload with extruded border so linear filtering does not bleed neighbours in
+		const std::vector<unsigned char> padded = AtlasPacker::extrudeImage(tex_data, texture.size, ATLAS_PADDING);
+		glTextureSubImage3D(atlas_texture, 0,
+			region.pos.x - ATLAS_PADDING, region.pos.y - ATLAS_PADDING, region.layer,
+			texture.size.x + ATLAS_PADDING * 2, texture.size.y + ATLAS_PADDING * 2, 1,
+			GL_RGBA, GL_UNSIGNED_BYTE, padded.data());
+
+		texture.atlas_layer = region.layer;
+		texture.atlas_uv_offset = { static_cast<float>(region.pos.x) / ATLAS_LAYER_SIZE, static_cast<float>(region.pos.y) / ATLAS_LAYER_SIZE };
+		texture.atlas_uv_scale = { static_cast<float>(region.size.x) / ATLAS_LAYER_SIZE, static_cast<float>(region.size.y) / ATLAS_LAYER_SIZE };
+	}
+
+	unsigned int Assets::RenderLoader::getTextureAtlas() const {
+		return atlas_texture;
 	}
 }
 
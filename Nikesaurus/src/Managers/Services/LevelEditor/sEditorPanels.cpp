@@ -1919,11 +1919,11 @@ namespace NIKE {
 				if (checkGridSnapping()) {
 
 					//Get snapped to cell position
-					auto cursor_cell = NIKE_MAP_SERVICE->getCellAtPosition(e_transform.position);
+					auto cursor_cell = NIKE_MAP_SERVICE->getCellIndexFromCords(e_transform.position);
 					if (cursor_cell.has_value()) {
 
 						//Snap to cell
-						e_transform.position = cursor_cell.value().get().position - parent_pos;
+						e_transform.position = NIKE_MAP_SERVICE->getCellPosition(cursor_cell.value()) - parent_pos;
 					}
 				}
 
@@ -3459,6 +3459,12 @@ namespace NIKE {
 					ImGui::Text("Total Active System Time: %.2f ms", NIKE_DEBUG_SERVICE->getTotalSystemTime());
 				}
 
+				// Display render culling
+				ImGui::Separator();
+				ImGui::Text("Render Culling:");
+				ImGui::Text("Visible Entities: %d", NIKE_DEBUG_SERVICE->getRenderVisibleCount());
+				ImGui::Text("Culled Entities: %d", NIKE_DEBUG_SERVICE->getRenderCulledCount());
+
 				ImGui::EndTabItem();
 			}
 
@@ -5571,12 +5577,12 @@ namespace NIKE {
 	void LevelEditor::TileMapPanel::render() {
 		//Clicking to set map cells to blocked
 		auto game_window = std::dynamic_pointer_cast<GameWindowPanel>(NIKE_LVLEDITOR_SERVICE->getPanel(GameWindowPanel::getStaticName()));
-		auto wrapped_cell = NIKE_MAP_SERVICE->getCursorCell();
-		if (!checkPopUpShowing() && !main_panel.lock()->getGameState() && b_grid_edit && game_window->isMouseInWindow() && wrapped_cell.has_value() && ImGui::GetIO().MouseClicked[ImGuiMouseButton_Left]) {
+		auto cursor_cell = NIKE_MAP_SERVICE->getCursorCell();
+		if (!checkPopUpShowing() && !main_panel.lock()->getGameState() && b_grid_edit && game_window->isMouseInWindow() && cursor_cell.has_value() && ImGui::GetIO().MouseClicked[ImGuiMouseButton_Left]) {
 
 			//Set cell to blocked
-			auto& cell = wrapped_cell.value().get();
-			cell.b_blocked = !cell.b_blocked;
+			auto const& index = cursor_cell.value();
+			NIKE_MAP_SERVICE->setCellBlocked(index.x, index.y, !NIKE_MAP_SERVICE->isCellBlocked(index.x, index.y));
 		}
 
 		//Begin Render
@@ -5951,11 +5957,12 @@ namespace NIKE {
 
 		//Render dark hue over blocked squaress
 		// I changed to red so i can see clearer - lim
-		for (auto const& row : NIKE_MAP_SERVICE->getGrid()) {
-			for (auto const& cell : row) {
-				if (cell.b_blocked) {
-					draw->AddRectFilled(worldToScreen({ cell.position.x - (cell_size.x / 2.0f) + (grid_thickness / fullscreen_scale.x),  cell.position.y - (cell_size.y / 2.0f) + (grid_thickness / fullscreen_scale.x) }, rendersize),
-						worldToScreen({ cell.position.x + (cell_size.x / 2.0f) - (grid_thickness / fullscreen_scale.x),  cell.position.y + (cell_size.y / 2.0f) - (grid_thickness / fullscreen_scale.x) }, rendersize), IM_COL32(255, 0, 0, 100));
+		for (int y = 0; y < grid_size.y; ++y) {
+			for (int x = 0; x < grid_size.x; ++x) {
+				if (NIKE_MAP_SERVICE->isCellBlocked(x, y)) {
+					Vector2f cell_pos = NIKE_MAP_SERVICE->getCellPosition({ x, y });
+					draw->AddRectFilled(worldToScreen({ cell_pos.x - (cell_size.x / 2.0f) + (grid_thickness / fullscreen_scale.x),  cell_pos.y - (cell_size.y / 2.0f) + (grid_thickness / fullscreen_scale.x) }, rendersize),
+						worldToScreen({ cell_pos.x + (cell_size.x / 2.0f) - (grid_thickness / fullscreen_scale.x),  cell_pos.y + (cell_size.y / 2.0f) - (grid_thickness / fullscreen_scale.x) }, rendersize), IM_COL32(255, 0, 0, 100));
 				}
 			}
 		}
@@ -6493,11 +6500,11 @@ namespace NIKE {
 			Vector2f render_pos;
 			if (tile_map_panel.lock()->checkGridSnapping()) {
 				//Get snapped to cell position
-				auto cursor_cell = NIKE_MAP_SERVICE->getCellAtPosition(Vector2f(world_mouse_pos.x, world_mouse_pos.y));
+				auto cursor_cell = NIKE_MAP_SERVICE->getCellIndexFromCords(Vector2f(world_mouse_pos.x, world_mouse_pos.y));
 				if (cursor_cell.has_value()) {
 
 					//Snap to cell
-					render_pos = cursor_cell.value().get().position;
+					render_pos = NIKE_MAP_SERVICE->getCellPosition(cursor_cell.value());
 				}
 				else {
 					render_pos = { world_mouse_pos.x, world_mouse_pos.y };
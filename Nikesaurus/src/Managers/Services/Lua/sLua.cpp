@@ -57,7 +57,7 @@ namespace NIKE {
 
     void Lua::Script::overrideDeserialize(nlohmann::json const& data) {
         if (data.contains("Script_ID")) {
-            script_id = data["Script_ID"];
+            script_id = data["Script_ID"].get<std::string>();
         }
 
         if (data.contains("Start_Function")) {
@@ -75,28 +75,179 @@ namespace NIKE {
         }
     }
 
-    std::shared_ptr<sol::load_result> Lua::Service::getLuaAssset(std::string const& script_id) const {
+    std::shared_ptr<sol::load_result> Lua::Service::getLuaAssset(Utility::StringID script_handle) const {
         //Get script table from asset service
-       return NIKE_ASSETS_SERVICE->getAsset<sol::load_result>(script_id);
+       return NIKE_ASSETS_SERVICE->getAsset<sol::load_result>(script_handle);
     }
 
     void Lua::Service::uncacheLuaAsset(std::string const& script_id) const {
         NIKE_ASSETS_SERVICE->uncacheAsset(script_id);
     }
 
-    sol::table Lua::Service::convertScriptArgs(Script const& script) const {
-        //Convert arguments to a Lua table
-        sol::table lua_args = lua_state->create_table();
-        for (const auto& pair : script.named_args) {
-            const auto& key = pair.first;
-            const auto& value = pair.second;
+    Lua::Service::ScriptModule& Lua::Service::getScriptModule(Utility::StringID script_handle) {
 
-            std::visit([&lua_args, &key](auto&& arg) {
-                lua_args[key] = arg;
+        //Reuse module until invalidated
+        auto module_it = script_modules.find(script_handle);
+        if (module_it != script_modules.end()) {
+            return module_it->second;
+        }
+
+        //Get script chunk from asset service
+        auto chunk = getLuaAssset(script_handle);
+
+        //Check if script is loaded correctly
+        if (!chunk || !chunk->valid()) {
+            throw std::runtime_error("Invalid Lua script: script is not loaded correctly.");
+        }
+
+        //Execute chunk once to build module
+        sol::protected_function_result result = (*chunk)();
+        if (!result.valid()) {
+            sol::error err = result;
+            throw std::runtime_error(err.what());
+        }
+
+        auto& module = script_modules[script_handle];
+        module.object = result.get<sol::object>();
+
+        return module;
+    }
+
+    sol::protected_function Lua::Service::getScriptFunction(ScriptModule& module, std::string const& function) {
+
+        //Check if module here is not a table
+        if (module.object.get_type() != sol::type::table) {
+            throw std::runtime_error("Error! Cant call a function from a function script!");
+        }
+
+        //Check resolved functions
+        auto func_it = module.functions.find(function);
+        if (func_it != module.functions.end()) {
+            return func_it->second;
+        }
+
+        //Resolve function from module table
+        sol::table module_table = module.object;
+        sol::object func = module_table[function];
+        if (func.get_type() != sol::type::function) {
+            return sol::protected_function();
+        }
+
+        return module.functions.emplace(function, func.as<sol::protected_function>()).first->second;
+    }
+
+    sol::table Lua::Service::getScriptArgs(Script const& script, Entity::Type entity) {
+        auto& args = script_args[entity][script.script_id.getID()];
+
+        //Create table on first use
+        if (!args.table.valid()) {
+            args.table = lua_state->create_table();
+        }
+        else if (args.values == script.named_args) {
+            return args.table;
+        }
+
+        //Clear args that were removed
+        for (auto const& [key, value] : args.values) {
+            if (script.named_args.find(key) == script.named_args.end()) {
+                args.table[key] = sol::lua_nil;
+            }
+        }
+
+        //Write named args into table
+        for (auto const& [key, value] : script.named_args) {
+            std::visit([&args, &key](auto&& arg) {
+                args.table[key] = arg;
                 }, value);
         }
+        args.values = script.named_args;
 
-        return lua_args;
+        return args.table;
+    }
+
+    sol::object Lua::Service::callScriptFunction(sol::protected_function const& function, Script const& script, Entity::Type entity) {
+
+        //Execute the Lua function with provided arguments
+        sol::protected_function_result result = function(script.named_args.size(), getScriptArgs(script, entity));
+        if (!result.valid()) {
+            sol::error err = result;
+            throw std::runtime_error(err.what());
+        }
+
+        return result.get<sol::object>();
+    }
+
+    void Lua::Service::onEvent(std::shared_ptr<Coordinator::EntitiesChanged> event) {
+
+        //Remove args of destroyed entities
+        for (auto entity : event->removed) {
+            script_args.erase(entity);
+        }
+    }
+
+    void Lua::Service::invalidateScriptModule(std::string const& script_id) {
+        script_modules.erase(Utility::hashString(script_id));
+    }
+
+    void Lua::Service::invalidateScriptModules() {
+        script_modules.clear();
+    }
+
+    sol::object Lua::Service::executeScript(Script& script, Entity::Type entity) {
+
+        try {
+            if (!script.start_function.empty() && !script.start_function_executed) {
+                sol::protected_function start_function = getScriptFunction(getScriptModule(script.script_id.getID()), script.start_function);
+                if (start_function.valid()) {
+                    NIKEE_CORE_INFO("Executing start function: {}", script.start_function);
+
+                    // Execute the start function
+                    callScriptFunction(start_function, script, entity);
+
+                    // Mark the start function as executed
+                    script.start_function_executed = true;
+                }
+                else {
+                    throw std::runtime_error("Start function not found in script table: " + script.start_function);
+                }
+            }
+
+            //Get cached script module ( Fetched after start function, which may clear the cache )
+            auto& module = getScriptModule(script.script_id.getID());
+
+            //No function to be called
+            if (script.update_function.empty()) {
+
+                //Execute script table
+                if (module.object.get_type() == sol::type::table) {
+                    return module.object;
+                }
+
+                //Execute script function
+                else {
+                    sol::protected_function_result result = module.object.as<sol::protected_function>()();
+                    if (!result.valid()) {
+                        sol::error err = result;
+                        throw std::runtime_error(err.what());
+                    }
+                    return result.get<sol::object>();
+                }
+            }
+
+            //Function to be called
+            sol::protected_function script_function = getScriptFunction(module, script.update_function);
+            if (!script_function.valid()) {
+                throw std::runtime_error("Function not found in script table: " + script.update_function);
+            }
+
+            //Execute the Lua function with provided arguments
+            return callScriptFunction(script_function, script, entity);
+        }
+        catch (std::runtime_error const& e) {
+            NIKEE_CORE_WARN(e.what());
+            uncacheLuaAsset(script.script_id);
+            return sol::nil;
+        }
     }
 
     void Lua::Service::init() {
@@ -105,6 +256,10 @@ namespace NIKE {
         //Lua state init
         lua_state->open_libraries(sol::lib::base, sol::lib::math, sol::lib::string, sol::lib::table, sol::lib::io);
 
+        //Setup events listening
+        std::shared_ptr<Lua::Service> lua_service(this, [](Lua::Service*) {});
+        NIKE_EVENTS_SERVICE->addEventListeners<Coordinator::EntitiesChanged>(lua_service);
+
         //Register all bindings here
         luaBasicBinds(*lua_state);
         luaKeyBinds(*lua_state);
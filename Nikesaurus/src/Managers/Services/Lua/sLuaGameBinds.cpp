@@ -326,6 +326,12 @@ namespace NIKE {
                 bullet_dynamics.value().get().force = bullet_force;
             }
 
+            // Sweep bullet against broadphase so it cannot tunnel through thin colliders
+            auto bullet_collider = NIKE_ECS_MANAGER->getEntityComponent<Physics::Collider>(bullet_entity);
+            if (bullet_collider.has_value()) {
+                bullet_collider.value().get().b_continuous = true;
+            }
+
             //Set initial bullet position to player's position
             auto bullet_transform = NIKE_ECS_MANAGER->getEntityComponent<Transform::Transform>(bullet_entity);
             if (bullet_transform.has_value()) {
@@ -589,34 +595,34 @@ namespace NIKE {
                     //Get start index
                     auto start_index = start.value();
 
-                    //Check if path has been generated or if destination cell has changed
-                    if (!NIKE_MAP_SERVICE->checkPath(entity) ||
-                        NIKE_MAP_SERVICE->checkGridChanged() ||
-                        (NIKE_MAP_SERVICE->getPath(entity).goal.index != Vector2i(x_index, y_index)) ||
+                    //Check if path has been generated or if destination cell has changed ( skipped while a request is queued )
+                    if (!NIKE_MAP_SERVICE->isPathPending(entity) && (!NIKE_MAP_SERVICE->checkPath(entity) ||
+                        NIKE_MAP_SERVICE->isPathAffected(entity) ||
+                        (NIKE_MAP_SERVICE->getPath(entity).goal != Vector2i(x_index, y_index)) ||
                         (!NIKE_MAP_SERVICE->getPath(entity).path.empty() &&
-                            (std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().index.x - start_index.x) > 1 ||
-                                std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().index.y - start_index.y) > 1)) ||
-                        (NIKE_MAP_SERVICE->getPath(entity).b_finished && start_index != NIKE_MAP_SERVICE->getPath(entity).end.index)
+                            (std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().x - start_index.x) > 1 ||
+                                std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().y - start_index.y) > 1)) ||
+                        (NIKE_MAP_SERVICE->getPath(entity).b_finished && start_index != NIKE_MAP_SERVICE->getPath(entity).end))
                         ) {
 
-                        //Search for path
-                        NIKE_MAP_SERVICE->findPath(entity, start_index, Vector2i(x_index, y_index));
+                        //Queue path search ( serviced within budget by updatePathRequests )
+                        NIKE_MAP_SERVICE->requestPath(entity, start_index, Vector2i(x_index, y_index));
                     }
 
-                    //Get path 
-                    auto path = NIKE_MAP_SERVICE->getPath(entity);
+                    //Get path ( previous path is followed until queued search completes )
+                    auto const& path = NIKE_MAP_SERVICE->getPath(entity);
 
                     //Check if there are cells left in path
                     if (!path.path.empty()) {
 
                         //Get next cell
-                        auto const& next_cell = path.path.front();
+                        Vector2f next_cell = NIKE_MAP_SERVICE->getCellPosition(path.path.front());
 
                         //Check if entity has arrived near destination
-                        if ((next_cell.position - e_transform.position).length() > cell_offset) {
+                        if ((next_cell - e_transform.position).length() > cell_offset) {
 
                             //Direction of next cell
-                            float dir = atan2((next_cell.position.y - e_transform.position.y), (next_cell.position.x - e_transform.position.x));
+                            float dir = atan2((next_cell.y - e_transform.position.y), (next_cell.x - e_transform.position.x));
 
                             //Apply force to entity
                             auto dynamics = NIKE_ECS_MANAGER->getEntityComponent<Physics::Dynamics>(entity);
@@ -624,16 +630,44 @@ namespace NIKE {
                                 dynamics.value().get().force = { cos(dir) * speed, sin(dir) * speed };
                             }
                         }
-                        else {
-                            path.path.pop_front();
-                        }
-                    }
-                    else {
-                        //Marked path as finished
-                        path.b_finished = true;
                     }
                 }
             }
             });
+
+        //Line of sight between two cells ( false when outside of grid )
+        lua_state.set_function("LineOfSight", [&](int from_x, int from_y, int to_x, int to_y) -> bool {
+            Vector2i grid_size = NIKE_MAP_SERVICE->getGridSize();
+            if (from_x < 0 || from_x >= grid_size.x || from_y < 0 || from_y >= grid_size.y ||
+                to_x < 0 || to_x >= grid_size.x || to_y < 0 || to_y >= grid_size.y) {
+                return false;
+            }
+
+            return NIKE_MAP_SERVICE->hasLineOfSight(Vector2i(from_x, from_y), Vector2i(to_x, to_y));
+            });
+
+        //Line of sight between cells of two entities
+        lua_state.set_function("EntityLineOfSight", [&](Entity::Type entity, Entity::Type target) -> bool {
+            auto e_transform = NIKE_ECS_MANAGER->getEntityComponent<Transform::Transform>(entity);
+            auto t_transform = NIKE_ECS_MANAGER->getEntityComponent<Transform::Transform>(target);
+            if (!e_transform.has_value() || !t_transform.has_value()) return false;
+
+            auto from = NIKE_MAP_SERVICE->getCellIndexFromCords(e_transform.value().get().position);
+            auto to = NIKE_MAP_SERVICE->getCellIndexFromCords(t_transform.value().get().position);
+            if (!from.has_value() || !to.has_value()) return false;
+
+            return NIKE_MAP_SERVICE->hasLineOfSight(from.value(), to.value());
+            });
+
+        //Smoothed cells of entity path from entity position ( empty when entity has no path )
+        lua_state.set_function("SmoothPath", [&](Entity::Type entity) -> sol::as_table_t<std::vector<Vector2i>> {
+            auto transform = NIKE_ECS_MANAGER->getEntityComponent<Transform::Transform>(entity);
+            if (!transform.has_value() || !NIKE_MAP_SERVICE->checkPath(entity)) return sol::as_table(std::vector<Vector2i>());
+
+            auto start = NIKE_MAP_SERVICE->getCellIndexFromCords(transform.value().get().position);
+            if (!start.has_value()) return sol::as_table(std::vector<Vector2i>());
+
+            return sol::as_table(NIKE_MAP_SERVICE->smoothPath(start.value(), NIKE_MAP_SERVICE->getPath(entity).path));
+            });
     }
 }
@@ -0,0 +1,194 @@
+/*****************************************************************//**
+ * \file   sInstanceBuffer.cpp
+ * \brief  Per instance data and persistently mapped instance ring for batched rendering
+ *
+ * \author agent, agent@local (100%)
+ * \date   October 2026
+ * All content © 2026 DigiPen Institute of Technology Singapore, all rights reserved.
+ *********************************************************************/
+
+#include "Core/stdafx.h"
+#include "Managers/Services/Render/sInstanceBuffer.h"
+
+namespace NIKE {
+
+	/*****************************************************************//**
+	* Instance packing
+	*********************************************************************/
+
+	std::array<float, 6> Render::InstancePacking::packTransform(Matrix_33 const& x_form) {
+		//Matrix is stored column major for GL, each inner array is a column
+		return {
+			x_form.matrix_33[0][0], x_form.matrix_33[0][1],
+			x_form.matrix_33[1][0], x_form.matrix_33[1][1],
+			x_form.matrix_33[2][0], x_form.matrix_33[2][1]
+		};
+	}
+
+	std::array<uint8_t, 4> Render::InstancePacking::packColor(Vector4f const& color) {
+		auto to_unorm8 = [](float value) {
+			return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+			};
+
+		return { to_unorm8(color.r), to_unorm8(color.g), to_unorm8(color.b), to_unorm8(color.a) };
+	}
+
+	uint16_t Render::InstancePacking::packUnorm16(float value) {
+		return static_cast<uint16_t>(std::clamp(value, 0.0f, 1.0f) * 65535.0f + 0.5f);
+	}
+
+	Render::InstanceData Render::InstancePacking::packInstance(RenderInstance const& instance) {
+		InstanceData data;
+		data.xform = packTransform(instance.xform);
+		data.uv_offset = { instance.uv_offset.x, instance.uv_offset.y };
+		data.framesize = { instance.framesize.x, instance.framesize.y };
+		data.color = packColor(instance.color);
+		data.sampler_idx = static_cast<uint8_t>(instance.sampler_idx);
+		data.blend = instance.to_blend_color ? 1 : 0;
+		data.blend_intensity = packUnorm16(instance.blend_intensity);
+		return data;
+	}
+
+	void Render::InstancePacking::packInstances(std::vector<RenderInstance> const& instances, InstanceData* dst) {
+		for (auto const& instance : instances) {
+			*dst++ = packInstance(instance);
+		}
+	}
+
+	/*****************************************************************//**
+	* Instance ring
+	*********************************************************************/
+
+	void Render::InstanceRing::init(unsigned int capacity_per_segment) {
+		if (buffer) {
+			cleanup();
+		}
+
+		segment_capacity = capacity_per_segment;
+		segment = 0;
+		cursor = 0;
+
+		//Immutable storage, mapped once for the lifetime of the buffer
+		static constexpr GLbitfield MAP_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		const GLsizeiptr size = static_cast<GLsizeiptr>(sizeof(InstanceData)) * segment_capacity * NUM_SEGMENTS;
+
+		glCreateBuffers(1, &buffer);
+		glNamedBufferStorage(buffer, size, nullptr, MAP_FLAGS);
+		mapped = static_cast<InstanceData*>(glMapNamedBufferRange(buffer, 0, size, MAP_FLAGS));
+
+		if (!mapped) {
+			throw std::runtime_error("Failed to persistently map instance buffer.");
+		}
+	}
+
+	void Render::InstanceRing::cleanup() {
+		for (auto& fence : fences) {
+			if (fence) {
+				glDeleteSync(fence);
+				fence = nullptr;
+			}
+		}
+
+		if (buffer) {
+			glUnmapNamedBuffer(buffer);
+			glDeleteBuffers(1, &buffer);
+		}
+
+		buffer = 0;
+		mapped = nullptr;
+	}
+
+	Render::InstanceData* Render::InstanceRing::allocate(unsigned int count, unsigned int& base_instance) {
+		if (!mapped || count > segment_capacity) {
+			throw std::out_of_range("Instance ring allocation exceeds segment capacity.");
+		}
+
+		//Segment exhausted within a frame, move on early
+		if (cursor + count > segment_capacity) {
+			advance();
+		}
+
+		base_instance = segment * segment_capacity + cursor;
+		cursor += count;
+
+		return mapped + base_instance;
+	}
+
+	void Render::InstanceRing::advance() {
+		if (!mapped) {
+			return;
+		}
+
+		//Fence draws that read from the current segment
+		if (cursor > 0) {
+			fences[segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		}
+
+		//Next segment must be released by the GPU before it is overwritten
+		segment = (segment + 1) % NUM_SEGMENTS;
+		cursor = 0;
+		waitSegment(segment);
+	}
+
+	void Render::InstanceRing::waitSegment(unsigned int index) {
+		GLsync& fence = fences[index];
+		if (!fence) {
+			return;
+		}
+
+		//Wait in 1ms steps, flush on first wait so the fence is guaranteed to signal
+		static constexpr GLuint64 WAIT_TIMEOUT_NS = 1000000;
+		GLbitfield wait_flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+		while (true) {
+			const GLenum result = glClientWaitSync(fence, wait_flags, WAIT_TIMEOUT_NS);
+			if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED) {
+				break;
+			}
+
+			if (result == GL_WAIT_FAILED) {
+				NIKEE_CORE_ERROR("Instance ring fence wait failed.");
+				break;
+			}
+
+			wait_flags = 0;
+		}
+
+		glDeleteSync(fence);
+		fence = nullptr;
+	}
+
+	void Render::InstanceRing::bind(unsigned int vaoid) const {
+		glVertexArrayVertexBuffer(vaoid, BINDING_INDEX, buffer, 0, sizeof(InstanceData));
+	}
+
+	void Render::InstanceRing::setupAttributes(unsigned int vaoid) {
+		//Advance once per instance instead of per vertex
+		glVertexArrayBindingDivisor(vaoid, BINDING_INDEX, 1);
+
+		//Float attributes
+		auto float_attrib = [vaoid](unsigned int index, int size, GLenum type, bool normalized, size_t offset) {
+			glEnableVertexArrayAttrib(vaoid, index);
+			glVertexArrayAttribFormat(vaoid, index, size, type, normalized, static_cast<GLuint>(offset));
+			glVertexArrayAttribBinding(vaoid, index, BINDING_INDEX);
+			};
+
+		//Integer attributes
+		auto int_attrib = [vaoid](unsigned int index, int size, GLenum type, size_t offset) {
+			glEnableVertexArrayAttrib(vaoid, index);
+			glVertexArrayAttribIFormat(vaoid, index, size, type, static_cast<GLuint>(offset));
+			glVertexArrayAttribBinding(vaoid, index, BINDING_INDEX);
+			};
+
+		//Transform columns
+		for (unsigned int i = 0; i < 3; ++i) {
+			float_attrib(XFORM_ATTRIB_INDEX + i, 2, GL_FLOAT, false, offsetof(InstanceData, xform) + i * 2 * sizeof(float));
+		}
+
+		float_attrib(FRAMESIZE_ATTRIB_INDEX, 2, GL_FLOAT, false, offsetof(InstanceData, framesize));
+		float_attrib(UVOFFSET_ATTRIB_INDEX, 2, GL_FLOAT, false, offsetof(InstanceData, uv_offset));
+		float_attrib(COLOR_ATTRIB_INDEX, 4, GL_UNSIGNED_BYTE, true, offsetof(InstanceData, color));
+		float_attrib(BLENDINTENSITY_ATTRIB_INDEX, 1, GL_UNSIGNED_SHORT, true, offsetof(InstanceData, blend_intensity));
+		int_attrib(SAMPLERIDX_ATTRIB_INDEX, 1, GL_UNSIGNED_BYTE, offsetof(InstanceData, sampler_idx));
+		int_attrib(BLEND_ATTRIB_INDEX, 1, GL_UNSIGNED_BYTE, offsetof(InstanceData, blend));
+	}
+}
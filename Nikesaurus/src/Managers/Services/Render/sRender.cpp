@@ -201,6 +201,17 @@ namespace NIKE {
 
 		text_buffer.init();
 
+		// Instance data ring for batched rendering
+		if (BATCHED_RENDERING) {
+			instance_ring.init(INSTANCES_PER_RING_SEGMENT);
+
+			// texture slots always map to binding units of the same index
+			batch_tex_units.clear();
+			for (unsigned int i{}; i < static_cast<unsigned int>(MAX_UNIQUE_TEX_HDLS); i++) {
+				batch_tex_units.push_back(i);
+			}
+		}
+
 		//Setup event listening for frame buffer resize
 		std::shared_ptr<Render::Service> render_sys_wrapped(this, [](Render::Service*) {});
 		NIKE_EVENTS_SERVICE->addEventListeners<Windows::WindowResized>(render_sys_wrapped);
@@ -327,15 +338,19 @@ namespace NIKE {
 	*********************************************************************/
 
 	void Render::Service::renderObject(Matrix_33 const& x_form, Render::Shape const& e_shape) {
+		drawShape({ x_form, e_shape.model_id.getID(), e_shape.color, e_shape.use_override_color });
+	}
+
+	void Render::Service::drawShape(ShapeCommand const& cmd) {
 		GLenum err = glGetError();
 		if (err != GL_NO_ERROR) {
 			NIKEE_CORE_ERROR("OpenGL error at beginning of {0}: {1}", __FUNCTION__, err);
 		}
 
-		constexpr std::array<const char*, 1> QUAD_SHAPE_MODELS = { "square.model" };
+		constexpr std::array<Utility::StringID, 1> QUAD_SHAPE_MODELS = { "square.model"_sid };
 
 
-		if (!BATCHED_RENDERING || std::find(QUAD_SHAPE_MODELS.begin(), QUAD_SHAPE_MODELS.end(), e_shape.model_id) == QUAD_SHAPE_MODELS.end()) {
+		if (!BATCHED_RENDERING || std::find(QUAD_SHAPE_MODELS.begin(), QUAD_SHAPE_MODELS.end(), cmd.model_id) == QUAD_SHAPE_MODELS.end()) {
 
 			//Set polygon mode
 			// glPolygonMode(GL_FRONT, GL_FILL);
@@ -345,13 +360,13 @@ namespace NIKE {
 			shader_manager->useShader("base");
 
 			//Shader set uniform
-			shader_manager->setUniform("base", "f_color", Vector3f(e_shape.color.r, e_shape.color.g, e_shape.color.b));
-			shader_manager->setUniform("base", "f_opacity", e_shape.color.a);
-			shader_manager->setUniform("base", "override_color", e_shape.use_override_color);
-			shader_manager->setUniform("base", "model_to_ndc", x_form);
+			shader_manager->setUniform("base", "f_color", Vector3f(cmd.color.r, cmd.color.g, cmd.color.b));
+			shader_manager->setUniform("base", "f_opacity", cmd.color.a);
+			shader_manager->setUniform("base", "override_color", cmd.use_override_color);
+			shader_manager->setUniform("base", "model_to_ndc", cmd.xform);
 
 			//Get model
-			auto model = NIKE_ASSETS_SERVICE->getAsset<Assets::Model>(e_shape.model_id);
+			auto model = NIKE_ASSETS_SERVICE->getAsset<Assets::Model>(cmd.model_id);
 
 			//Draw
 			glBindVertexArray(model->vaoid);
@@ -364,8 +379,8 @@ namespace NIKE {
 		else {
 			// prepare for batched rendering
 			RenderInstance instance;
-			instance.xform = x_form;
-			instance.color = e_shape.color;
+			instance.xform = cmd.xform;
+			instance.color = cmd.color;
 
 			render_instances_quad.push_back(instance);
 
@@ -381,19 +396,24 @@ namespace NIKE {
 	}
 
 	void Render::Service::renderObject(Matrix_33 const& x_form, Render::Texture const& e_texture) {
+		drawTexture({ x_form, e_texture.texture_id.getID(), e_texture.color, e_texture.frame_size, e_texture.frame_index, e_texture.b_blend, e_texture.intensity });
+	}
+
+	void Render::Service::drawTexture(TextureCommand const& cmd) {
 		GLenum err = glGetError();
 		if (err != GL_NO_ERROR) {
 			NIKEE_CORE_ERROR("OpenGL error at beginning of {0}: {1}", __FUNCTION__, err);
 		}
 
 		//Caculate UV Offset
-		const Vector2f framesize{ (1.0f / e_texture.frame_size.x) , (1.0f / e_texture.frame_size.y) };
-		Vector2f uv_offset{ e_texture.frame_index.x * framesize.x, e_texture.frame_index.y * framesize.y };
+		const Vector2f framesize{ (1.0f / cmd.frame_size.x) , (1.0f / cmd.frame_size.y) };
+		Vector2f uv_offset{ cmd.frame_index.x * framesize.x, cmd.frame_index.y * framesize.y };
 
 		//Translate UV offset to bottom left
 		uv_offset.y = std::abs(1 - uv_offset.y - framesize.y);
 
-		const unsigned int tex_hdl = NIKE_ASSETS_SERVICE->getAsset<Assets::Texture>(e_texture.texture_id)->gl_data;
+		const auto texture = NIKE_ASSETS_SERVICE->getAsset<Assets::Texture>(cmd.texture_id);
+		const unsigned int tex_hdl = texture->gl_data;
 
 		if (!BATCHED_RENDERING) {
 			//Set polygon mode
@@ -416,22 +436,22 @@ namespace NIKE {
 
 			//Set uniforms for texture rendering
 			shader_manager->setUniform("texture", "u_tex2d", texture_unit);
-			shader_manager->setUniform("texture", "u_opacity", e_texture.color.a);
-			shader_manager->setUniform("texture", "u_transform", x_form);
+			shader_manager->setUniform("texture", "u_opacity", cmd.color.a);
+			shader_manager->setUniform("texture", "u_transform", cmd.xform);
 			shader_manager->setUniform("texture", "uvOffset", uv_offset);
 			shader_manager->setUniform("texture", "frameSize", framesize);
 
 			//Blending options for texture
-			shader_manager->setUniform("texture", "u_color", Vector3f(e_texture.color.r, e_texture.color.g, e_texture.color.b));
-			shader_manager->setUniform("texture", "u_blend", e_texture.b_blend);
-			shader_manager->setUniform("texture", "u_intensity", e_texture.intensity);
+			shader_manager->setUniform("texture", "u_color", Vector3f(cmd.color.r, cmd.color.g, cmd.color.b));
+			shader_manager->setUniform("texture", "u_blend", cmd.b_blend);
+			shader_manager->setUniform("texture", "u_intensity", cmd.intensity);
 
 			//Flip texture options
 			//shader_manager->setUniform("texture", "u_fliphorizontal", e_texture.b_flip.x);
 			//shader_manager->setUniform("texture", "u_flipvertical", e_texture.b_flip.y);
 
 			//Get model
-			auto& model = *NIKE_ASSETS_SERVICE->getAsset<Assets::Model>("square-texture.model");
+			auto& model = *NIKE_ASSETS_SERVICE->getAsset<Assets::Model>("square-texture.model"_sid);
 
 			//Draw
 			glBindVertexArray(model.vaoid);
@@ -444,21 +464,28 @@ namespace NIKE {
 		else {
 			// prepare for batched rendering
 			RenderInstance instance;
-			instance.xform = x_form;
+			instance.xform = cmd.xform;
 			instance.tex = tex_hdl;
 			instance.framesize = framesize;
 			instance.uv_offset = uv_offset;
-			instance.to_blend_color = e_texture.b_blend;
-			instance.color = e_texture.color;
-			instance.blend_intensity = e_texture.intensity;
+			instance.to_blend_color = cmd.b_blend;
+			instance.color = cmd.color;
+			instance.blend_intensity = cmd.intensity;
+
+			if (texture->atlas_layer >= 0) {
+				// atlas textures share one array texture, remap frame uv into the packed rect
+				instance.sampler_idx = ATLAS_SAMPLER_BASE + static_cast<unsigned int>(texture->atlas_layer);
+				instance.framesize = { framesize.x * texture->atlas_uv_scale.x, framesize.y * texture->atlas_uv_scale.y };
+				instance.uv_offset = { texture->atlas_uv_offset.x + uv_offset.x * texture->atlas_uv_scale.x, texture->atlas_uv_offset.y + uv_offset.y * texture->atlas_uv_scale.y };
+			}
+			else {
+				// system can only handle max 31 unique texture binding units, slot lookup flushes the batch when they run out
+				instance.sampler_idx = getBatchTextureSlot(tex_hdl);
+			}
 
 			render_instances_texture.push_back(instance);
 
-			// used to track number of unique texture handles
-			// system can only handle max 32 unique texture binding units, hence have to clear texture render instances or not all textures will render properly.
-			curr_instance_unique_tex_hdls.insert(tex_hdl);
-
-			if (render_instances_texture.size() >= MAX_INSTANCES || curr_instance_unique_tex_hdls.size() >= MAX_UNIQUE_TEX_HDLS) {
+			if (render_instances_texture.size() >= MAX_INSTANCES) {
 				batchRenderTextures();
 			}
 		}
@@ -469,6 +496,10 @@ namespace NIKE {
 	}
 
 	void Render::Service::renderObject(Matrix_33 const& x_form, Render::Video const& e_video) {
+		drawVideo({ x_form, e_video.texture_id });
+	}
+
+	void Render::Service::drawVideo(VideoCommand const& cmd) {
 		GLenum err = glGetError();
 		if (err != GL_NO_ERROR) {
 			NIKEE_CORE_ERROR("OpenGL error at beginning of {0}: {1}", __FUNCTION__, err);
@@ -482,7 +513,7 @@ namespace NIKE {
 		bool blend_mode = false;
 		float intensity = 1.0f;
 
-		const unsigned int tex_hdl = e_video.texture_id;
+		const unsigned int tex_hdl = cmd.texture_id;
 
 		if (!BATCHED_RENDERING) {
 			//Set polygon mode
@@ -506,7 +537,7 @@ namespace NIKE {
 			//Set uniforms for texture rendering
 			shader_manager->setUniform("texture", "u_tex2d", texture_unit);
 			shader_manager->setUniform("texture", "u_opacity", color.a);
-			shader_manager->setUniform("texture", "u_transform", x_form);
+			shader_manager->setUniform("texture", "u_transform", cmd.xform);
 			shader_manager->setUniform("texture", "uvOffset", uv_offset);
 			shader_manager->setUniform("texture", "frameSize", framesize);
 
@@ -520,7 +551,7 @@ namespace NIKE {
 			//shader_manager->setUniform("texture", "u_flipvertical", e_texture.b_flip.y);
 
 			//Get model
-			auto& model = *NIKE_ASSETS_SERVICE->getAsset<Assets::Model>("square-texture.model");
+			auto& model = *NIKE_ASSETS_SERVICE->getAsset<Assets::Model>("square-texture.model"_sid);
 
 			//Draw
 			glBindVertexArray(model.vaoid);
@@ -533,7 +564,7 @@ namespace NIKE {
 		else {
 			// prepare for batched rendering
 			RenderInstance instance;
-			instance.xform = x_form;
+			instance.xform = cmd.xform;
 			instance.tex = tex_hdl;
 			instance.framesize = framesize;
 			instance.uv_offset = uv_offset;
@@ -541,13 +572,12 @@ namespace NIKE {
 			instance.color = color;
 			instance.blend_intensity = intensity;
 
-			render_instances_texture.push_back(instance);
+			// system can only handle max 31 unique texture binding units, slot lookup flushes the batch when they run out
+			instance.sampler_idx = getBatchTextureSlot(tex_hdl);
 
-			// used to track number of unique texture handles
-			// system can only handle max 32 unique texture binding units, hence have to clear texture render instances or not all textures will render properly.
-			curr_instance_unique_tex_hdls.insert(tex_hdl);
+			render_instances_texture.push_back(instance);
 
-			if (render_instances_texture.size() >= MAX_INSTANCES || curr_instance_unique_tex_hdls.size() >= MAX_UNIQUE_TEX_HDLS) {
+			if (render_instances_texture.size() >= MAX_INSTANCES) {
 				batchRenderTextures();
 			}
 		}
@@ -577,7 +607,7 @@ namespace NIKE {
 			shader_manager->setUniform("base", "model_to_ndc", x_form);
 
 			// Get model
-			auto model = NIKE_ASSETS_SERVICE->getAsset<Assets::Model>("square.model");
+			auto model = NIKE_ASSETS_SERVICE->getAsset<Assets::Model>("square.model"_sid);
 
 			// Draw model
 			glBindVertexArray(model->vaoid);
@@ -626,9 +656,12 @@ namespace NIKE {
 		//Temp text size
 		Vector2f text_size;
 
+		//Get font once for all characters
+		auto font = NIKE_ASSETS_SERVICE->getAsset<Assets::Font>(e_text.font_id.getID());
+
 		//Calculate size of text
 		for (char c : e_text.text) {
-			Assets::Font::Character ch = NIKE_ASSETS_SERVICE->getAsset<Assets::Font>(e_text.font_id)->char_map[c];
+			Assets::Font::Character ch = font->char_map[c];
 
 			//Calculate width
 			text_size.x += (ch.advance >> 6) * e_text.scale;
@@ -667,7 +700,7 @@ namespace NIKE {
 		//Iterate through all characters
 		for (char c : e_text.text)
 		{
-			Assets::Font::Character ch = NIKE_ASSETS_SERVICE->getAsset<Assets::Font>(e_text.font_id)->char_map[c];
+			Assets::Font::Character ch = font->char_map[c];
 
 			float xpos = pos.x + ch.bearing.x * e_text.scale;
 			float ypos = pos.y - (ch.size.y - ch.bearing.y) * e_text.scale;
@@ -720,24 +753,21 @@ namespace NIKE {
 		//Setup show cursor
 		NIKE_WINDOWS_SERVICE->getWindow()->setInputMode(NIKE_CURSOR, NIKE_CURSOR_HIDDEN);
 
-		auto texture_render = [bool_ch = is_crosshair, this]() {
-			static Render::Texture crosshair = { "crosshair.png", { 1.f, 1.f, 1.f, 1.f }, false, 1.f, false, Vector2i{ 1, 1 }, Vector2i{ 0, 0 }, Vector2b{false, false} };
-			static Render::Texture cursor = { "cursor_highlighted.png", { 1.f, 1.f, 1.f, 1.f }, false, 1.f, false, Vector2i{ 1, 1 }, Vector2i{ 0, 0 }, Vector2b{false, false} };
-
-			Matrix_33 cur_matrix;
-			Transform::Transform cur_transform = { Vector2f(0.f, 0.f), Vector2f(50.0f, 50.0f), 0.0f };
-			cur_transform.scale.x *= NIKE_CAMERA_SERVICE->getActiveCamera().zoom;
-			cur_transform.scale.y *= NIKE_CAMERA_SERVICE->getActiveCamera().zoom;
-			cur_transform.position.x = bool_ch ? NIKE_INPUT_SERVICE->getMouseWorldPos().x : NIKE_INPUT_SERVICE->getMouseWorldPos().x + cur_transform.scale.x / 2;
-			cur_transform.position.y = bool_ch ? NIKE_INPUT_SERVICE->getMouseWorldPos().y : NIKE_INPUT_SERVICE->getMouseWorldPos().y - cur_transform.scale.y / 2;;
-			cur_transform.use_screen_pos = true;
-
-			// Render cursor
-			transformMatrix(cur_transform, cur_matrix, NIKE_CAMERA_SERVICE->getWorldToNDCXform(false));
-			renderObject(cur_matrix, bool_ch ? crosshair : cursor);
-		};
-
-		screen_render_queue.push(texture_render);
+		//Cursor textures
+		static constexpr Utility::StringID CROSSHAIR_TEXTURE = "crosshair.png"_sid;
+		static constexpr Utility::StringID CURSOR_TEXTURE = "cursor_highlighted.png"_sid;
+
+		Matrix_33 cur_matrix;
+		Transform::Transform cur_transform = { Vector2f(0.f, 0.f), Vector2f(50.0f, 50.0f), 0.0f };
+		cur_transform.scale.x *= NIKE_CAMERA_SERVICE->getActiveCamera().zoom;
+		cur_transform.scale.y *= NIKE_CAMERA_SERVICE->getActiveCamera().zoom;
+		cur_transform.position.x = is_crosshair ? NIKE_INPUT_SERVICE->getMouseWorldPos().x : NIKE_INPUT_SERVICE->getMouseWorldPos().x + cur_transform.scale.x / 2;
+		cur_transform.position.y = is_crosshair ? NIKE_INPUT_SERVICE->getMouseWorldPos().y : NIKE_INPUT_SERVICE->getMouseWorldPos().y - cur_transform.scale.y / 2;;
+		cur_transform.use_screen_pos = true;
+
+		//Cursor is submitted after all entities, so it is drawn on top of the screen pass
+		transformMatrix(cur_transform, cur_matrix, NIKE_CAMERA_SERVICE->getWorldToNDCXform(false));
+		render_queue.submit(RenderPass::SCREEN, render_queue.nextDepth(), TextureCommand{ cur_matrix, is_crosshair ? CROSSHAIR_TEXTURE : CURSOR_TEXTURE, { 1.f, 1.f, 1.f, 1.f }, Vector2i{ 1, 1 }, Vector2i{ 0, 0 }, false, 1.f });
 	}
 
 	void Render::Service::renderParticleSystem(const NIKE::SysParticle::ParticleSystem& ps, [[maybe_unused]] bool use_screen_pos, const std::string& texture_ref) {
@@ -838,90 +868,111 @@ namespace NIKE {
 
 	void Render::Service::renderComponents(std::unordered_map<std::string, std::shared_ptr<void>> comps, bool debug) {
 
+		//Get component from map, nullptr if absent
+		auto find = [&comps](const char* type_name) -> void* {
+			auto it = comps.find(Utility::convertTypeString(type_name));
+			return it != comps.end() ? it->second.get() : nullptr;
+			};
+
+		RenderComponents render_comps;
+		render_comps.transform = static_cast<Transform::Transform*>(find(typeid(Transform::Transform).name()));
+		render_comps.texture = static_cast<Render::Texture*>(find(typeid(Render::Texture).name()));
+		render_comps.shape = static_cast<Render::Shape*>(find(typeid(Render::Shape).name()));
+		render_comps.collider = static_cast<Physics::Collider*>(find(typeid(Physics::Collider).name()));
+		render_comps.dynamics = static_cast<Physics::Dynamics*>(find(typeid(Physics::Dynamics).name()));
+		render_comps.text = static_cast<Render::Text*>(find(typeid(Render::Text).name()));
+		render_comps.particle = static_cast<Render::ParticleEmitter*>(find(typeid(Render::ParticleEmitter).name()));
+		render_comps.video = static_cast<Render::Video*>(find(typeid(Render::Video).name()));
+
+		renderComponents(render_comps, debug);
+	}
+
+	void Render::Service::renderEntity(Entity::Type entity, bool debug) {
+
+		//Read components through entity signature ( No maps or shared pointers )
+		RenderComponents render_comps;
+		render_comps.transform = NIKE_ECS_MANAGER->tryGetEntityComponent<Transform::Transform>(entity);
+		render_comps.texture = NIKE_ECS_MANAGER->tryGetEntityComponent<Render::Texture>(entity);
+		render_comps.shape = NIKE_ECS_MANAGER->tryGetEntityComponent<Render::Shape>(entity);
+		render_comps.collider = debug ? NIKE_ECS_MANAGER->tryGetEntityComponent<Physics::Collider>(entity) : nullptr;
+		render_comps.dynamics = debug ? NIKE_ECS_MANAGER->tryGetEntityComponent<Physics::Dynamics>(entity) : nullptr;
+		render_comps.text = NIKE_ECS_MANAGER->tryGetEntityComponent<Render::Text>(entity);
+		render_comps.particle = NIKE_ECS_MANAGER->tryGetEntityComponent<Render::ParticleEmitter>(entity);
+		render_comps.video = NIKE_ECS_MANAGER->tryGetEntityComponent<Render::Video>(entity);
+
+		renderComponents(render_comps, debug);
+	}
+
+	void Render::Service::renderComponents(RenderComponents const& comps, bool debug) {
+
 		//Get transform
-		auto trans_it = comps.find(Utility::convertTypeString(typeid(Transform::Transform).name()));
-		if (trans_it == comps.end()) {
+		if (!comps.transform) {
 			return;
 		}
-		auto& e_transform = *std::static_pointer_cast<Transform::Transform>(trans_it->second);
+		auto& e_transform = *comps.transform;
 
 		//Camera matrix
 		Matrix_33 cam_ndcx = e_transform.use_screen_pos ? NIKE_CAMERA_SERVICE->getFixedWorldToNDCXform() : NIKE_CAMERA_SERVICE->getWorldToNDCXform();
+
+		//Render passes
+		const RenderPass pass = e_transform.use_screen_pos ? RenderPass::SCREEN : RenderPass::WORLD;
+		const RenderPass text_pass = e_transform.use_screen_pos ? RenderPass::SCREEN_TEXT : RenderPass::WORLD_TEXT;
+		const RenderPass particle_pass = e_transform.use_screen_pos ? RenderPass::SCREEN_PARTICLE : RenderPass::WORLD_PARTICLE;
+
+		//All commands of this entity share a depth
+		const uint32_t depth = render_queue.nextDepth();
+
 		//Get Texture
 		{
-			auto tex_it = comps.find(Utility::convertTypeString(typeid(Render::Texture).name()));
-			if (tex_it != comps.end()) {
+			if (comps.texture) {
 
 				//Texture component
-				auto& e_texture = *std::static_pointer_cast<Render::Texture>(tex_it->second);
+				auto& e_texture = *comps.texture;
 
 				//Check if texture is loaded
-				if (NIKE_ASSETS_SERVICE->isAssetRegistered(e_texture.texture_id)) {
+				if (NIKE_ASSETS_SERVICE->isAssetRegistered(e_texture.texture_id.getID())) {
 
 					//Allow stretching of texture
 					if (!e_texture.b_stretch) {
 						//Copy transform for texture mapping ( Locks the transformation of a texture )
 						Vector2f tex_size{
-							static_cast<float>(NIKE_ASSETS_SERVICE->getAsset<Assets::Texture>(e_texture.texture_id)->size.x) / e_texture.frame_size.x,
-							static_cast<float>(NIKE_ASSETS_SERVICE->getAsset<Assets::Texture>(e_texture.texture_id)->size.y) / e_texture.frame_size.y
+							static_cast<float>(NIKE_ASSETS_SERVICE->getAsset<Assets::Texture>(e_texture.texture_id.getID())->size.x) / e_texture.frame_size.x,
+							static_cast<float>(NIKE_ASSETS_SERVICE->getAsset<Assets::Texture>(e_texture.texture_id.getID())->size.y) / e_texture.frame_size.y
 						};
 
 						e_transform.scale = tex_size.normalized() * e_transform.scale.length();
 					}
 
-					//Texture render function
-					auto texture_render = [cam_ndcx, e_texture, e_transform]() {
-						//Matrix used for rendering
-						Matrix_33 matrix;
-
-						// Transform matrix here
-						NIKE_RENDER_SERVICE->transformMatrix(e_transform, matrix, cam_ndcx, Vector2b{ e_texture.b_flip.x, e_texture.b_flip.y });
+					//Matrix used for rendering
+					Matrix_33 matrix;
 
-						// Render Texture
-						NIKE_RENDER_SERVICE->renderObject(matrix, e_texture);
-						};
+					// Transform matrix here
+					transformMatrix(e_transform, matrix, cam_ndcx, Vector2b{ e_texture.b_flip.x, e_texture.b_flip.y });
 
-					//Check for screen position
-					if (e_transform.use_screen_pos) {
-						screen_render_queue.push(texture_render);
-					}
-					else {
-						world_render_queue.push(texture_render);
-					}
+					//Submit texture
+					render_queue.submit(pass, depth, TextureCommand{ matrix, e_texture.texture_id.getID(), e_texture.color, e_texture.frame_size, e_texture.frame_index, e_texture.b_blend, e_texture.intensity });
 				}
 			}
 		}
 
 		//Get Shape
 		{
-			auto shape_it = comps.find(Utility::convertTypeString(typeid(Render::Shape).name()));
-			if (shape_it != comps.end()) {
+			if (comps.shape) {
 
 				//Shape component
-				auto& e_shape = *std::static_pointer_cast<Render::Shape>(shape_it->second);
+				auto& e_shape = *comps.shape;
 
 				//Check if model exists
-				if (NIKE_ASSETS_SERVICE->isAssetRegistered(e_shape.model_id)) {
+				if (NIKE_ASSETS_SERVICE->isAssetRegistered(e_shape.model_id.getID())) {
 
-					//Shape render function
-					auto shape_render = [e_shape, e_transform, cam_ndcx]() {
-						//Matrix used for rendering
-						Matrix_33 matrix;
+					//Matrix used for rendering
+					Matrix_33 matrix;
 
-						// Transform matrix here
-						NIKE_RENDER_SERVICE->transformMatrix(e_transform, matrix, cam_ndcx);
+					// Transform matrix here
+					transformMatrix(e_transform, matrix, cam_ndcx);
 
-						//Render Shape
-						NIKE_RENDER_SERVICE->renderObject(matrix, e_shape);
-						};
-
-					//Check for screen position
-					if (e_transform.use_screen_pos) {
-						screen_render_queue.push(shape_render);
-					}
-					else {
-						world_render_queue.push(shape_render);
-					}
+					//Submit shape
+					render_queue.submit(pass, depth, ShapeCommand{ matrix, e_shape.model_id.getID(), e_shape.color, e_shape.use_override_color });
 				}
 			}
 		}
@@ -933,85 +984,52 @@ namespace NIKE {
 				Vector4f bounding_box_color{ 1.0f, 0.0f, 0.0f, 1.0f };
 
 				//Get Collider
-				auto collider_it = comps.find(Utility::convertTypeString(typeid(Physics::Collider).name()));
-				if (collider_it != comps.end()) {
+				if (comps.collider) {
 
 					//Collider comp
-					auto& e_collider = *std::static_pointer_cast<Physics::Collider>(collider_it->second);
+					auto& e_collider = *comps.collider;
 
 					//Change color of bounding box on collision
 					if (e_collider.b_collided) {
 						bounding_box_color = { 0.0f, 1.0f, 0.0f, 1.0f };
 					}
 
-					//Shape render function
-					auto collider_render = [e_collider, bounding_box_color, cam_ndcx]() {
-						//Matrix used for rendering
-						Matrix_33 matrix;
-
-						//Calculate bounding box matrix
-						NIKE_RENDER_SERVICE->transformMatrix(e_collider.transform, matrix, cam_ndcx);
-						NIKE_RENDER_SERVICE->renderBoundingBox(matrix, bounding_box_color);
-						};
+					//Matrix used for rendering
+					Matrix_33 matrix;
 
-					//Check for screen position
-					if (e_transform.use_screen_pos) {
-						screen_render_queue.push(collider_render);
-					}
-					else {
-						world_render_queue.push(collider_render);
-					}
+					//Calculate bounding box matrix
+					transformMatrix(e_collider.transform, matrix, cam_ndcx);
+					render_queue.submit(pass, depth, BoundingBoxCommand{ matrix, bounding_box_color }, 0);
 				}
 				else {
 
-					//Shape render function
-					auto collider_render = [bounding_box_color, e_transform, cam_ndcx]() {
-						//Matrix used for rendering
-						Matrix_33 matrix;
-
-						//Calculate bounding box matrix
-						NIKE_RENDER_SERVICE->transformMatrix(e_transform, matrix, cam_ndcx);
-						NIKE_RENDER_SERVICE->renderBoundingBox(matrix, bounding_box_color);
-						};
+					//Matrix used for rendering
+					Matrix_33 matrix;
 
-					//Check for screen position
-					if (e_transform.use_screen_pos) {
-						screen_render_queue.push(collider_render);
-					}
-					else {
-						world_render_queue.push(collider_render);
-					}
+					//Calculate bounding box matrix
+					transformMatrix(e_transform, matrix, cam_ndcx);
+					render_queue.submit(pass, depth, BoundingBoxCommand{ matrix, bounding_box_color }, 0);
 				}
 
 				//Get Dynamics
-				auto dynamics_it = comps.find(Utility::convertTypeString(typeid(Physics::Dynamics).name()));
-				if (dynamics_it != comps.end()) {
+				if (comps.dynamics) {
 
 					//Collider comp
-					auto& e_dynamics = *std::static_pointer_cast<Physics::Dynamics>(dynamics_it->second);
+					auto& e_dynamics = *comps.dynamics;
 
 					if (e_dynamics.velocity.x != 0.0f || e_dynamics.velocity.y != 0.0f) {
 
-						//Shape render function
-						auto dir_render = [e_transform, e_dynamics, cam_ndcx, bounding_box_color]() {
-							//Matrix used for rendering
-							Matrix_33 matrix;
-
-							Transform::Transform dir_transform = e_transform;
-							dir_transform.scale.x = 1.0f;
-							dir_transform.rotation = -atan2(e_dynamics.velocity.x, e_dynamics.velocity.y) * static_cast<float>(180.0f / M_PI);
-							dir_transform.position += {0.0f, e_transform.scale.y / 2.0f};
-							NIKE_RENDER_SERVICE->transformDirectionMatrix(dir_transform, matrix, cam_ndcx);
-							NIKE_RENDER_SERVICE->renderBoundingBox(matrix, bounding_box_color);
-							};
-
-						//Check for screen position
-						if (e_transform.use_screen_pos) {
-							screen_render_queue.push(dir_render);
-						}
-						else {
-							world_render_queue.push(dir_render);
-						}
+						//Matrix used for rendering
+						Matrix_33 matrix;
+
+						Transform::Transform dir_transform = e_transform;
+						dir_transform.scale.x = 1.0f;
+						dir_transform.rotation = -atan2(e_dynamics.velocity.x, e_dynamics.velocity.y) * static_cast<float>(180.0f / M_PI);
+						dir_transform.position += {0.0f, e_transform.scale.y / 2.0f};
+						transformDirectionMatrix(dir_transform, matrix, cam_ndcx);
+
+						//Direction box is drawn after the collider box
+						render_queue.submit(pass, depth, BoundingBoxCommand{ matrix, bounding_box_color }, 1);
 					}
 				}
 			}
@@ -1019,50 +1037,36 @@ namespace NIKE {
 
 		//Get Text
 		{
-			auto text_it = comps.find(Utility::convertTypeString(typeid(Render::Text).name()));
-			if (text_it != comps.end()) {
+			if (comps.text) {
 
 				//Text component
-				auto& e_text = *std::static_pointer_cast<Render::Text>(text_it->second);
+				auto& e_text = *comps.text;
 
 				//Check if font exists
-				if (NIKE_ASSETS_SERVICE->isAssetRegistered(e_text.font_id)) {
-
-					//Text render function
-					auto text_render = [e_transform, cam_ndcx, &e_text]() {
-
-						//Transform matrix
-						Matrix_33 matrix;
+				if (NIKE_ASSETS_SERVICE->isAssetRegistered(e_text.font_id.getID())) {
 
-						//Make copy of transform, scale to 1.0f for calculating matrix
-						Transform::Transform copy = e_transform;
-						copy.scale = { 1.0f, 1.0f };
+					//Transform matrix
+					Matrix_33 matrix;
 
-						//Transform text matrix
-						NIKE_RENDER_SERVICE->transformMatrix(copy, matrix, cam_ndcx);
+					//Make copy of transform, scale to 1.0f for calculating matrix
+					Transform::Transform copy = e_transform;
+					copy.scale = { 1.0f, 1.0f };
 
-						//Render text
-						NIKE_RENDER_SERVICE->renderText(matrix, e_text);
-						};
+					//Transform text matrix
+					transformMatrix(copy, matrix, cam_ndcx);
 
-					//Check for screen position
-					if (e_transform.use_screen_pos) {
-						screen_text_render_queue.push(text_render);
-					}
-					else {
-						world_text_render_queue.push(text_render);
-					}
+					//Submit text
+					render_queue.submit(text_pass, depth, TextCommand{ matrix, &e_text });
 				}
 			}
 		}
 
 		//Get particle emitter
 		{
-			auto particle_it = comps.find(Utility::convertTypeString(typeid(Render::ParticleEmitter).name()));
-			if (particle_it != comps.end()) {
+			if (comps.particle) {
 
 				//Particle component
-				auto& e_particle = *std::static_pointer_cast<Render::ParticleEmitter>(particle_it->second);
+				auto& e_particle = *comps.particle;
 
 				//Get particle system
 				auto& particle_sys = *e_particle.p_system;
@@ -1097,29 +1101,17 @@ namespace NIKE {
 				//Update particle system
 				particle_manager->updateParticleSystem(particle_sys);
 
-				//Particle render function
-				auto particle_render = [&particle_sys, ref = e_particle.ref]() {
-
-					NIKE_RENDER_SERVICE->renderParticleSystem(particle_sys, ref == "mouseps1", particle_sys.texture_ref);
-					};
-
-				//Check for screen position !!!More work to be done here to ensure screen particles are rendered correctly
-				if (e_transform.use_screen_pos) {
-					screen_particle_render_queue.push(particle_render);
-				}
-				else {
-					world_particle_render_queue.push(particle_render);
-				}
+				//Submit particle system !!!More work to be done here to ensure screen particles are rendered correctly
+				render_queue.submit(particle_pass, depth, ParticleCommand{ &particle_sys, e_particle.ref == "mouseps1" });
 			}
 		}
 
 		//Get video
 		{
-			auto video_it = comps.find(Utility::convertTypeString(typeid(Render::Video).name()));
-			if (video_it != comps.end()) {
+			if (comps.video) {
 
 				//Video component
-				auto& e_video = *std::static_pointer_cast<Render::Video>(video_it->second);
+				auto& e_video = *comps.video;
 
 				//Check if video exists
 				if (NIKE_ASSETS_SERVICE->isAssetRegistered(e_video.video_id)) {
@@ -1133,100 +1125,104 @@ namespace NIKE {
 						//Clamp aspect ratio of texture
 						e_transform.scale = e_video.texture_size.normalized() * e_transform.scale.length();
 
-						//Video render function
-						auto video_render = [e_transform, cam_ndcx, &e_video]() {
-
-							//Transform matrix
-							Matrix_33 matrix;
-
-							//Transform video matrix
-							NIKE_RENDER_SERVICE->transformMatrix(e_transform, matrix, cam_ndcx);
+						//Transform matrix
+						Matrix_33 matrix;
 
-							//Render video
-							NIKE_RENDER_SERVICE->renderObject(matrix, e_video);
-							};
+						//Transform video matrix
+						transformMatrix(e_transform, matrix, cam_ndcx);
 
-						//Check for screen position
-						if (e_transform.use_screen_pos) {
-							screen_render_queue.push(video_render);
-						}
-						else {
-							world_render_queue.push(video_render);
-						}
+						//Submit video
+						render_queue.submit(pass, depth, VideoCommand{ matrix, e_video.texture_id });
 					}
 				}
 			}
 		}
 	}
 
-	/*****************************************************************//**
-	* BATCH RENDERING
-	*********************************************************************/
-
-	std::unordered_set<unsigned int> Render::Service::curr_instance_unique_tex_hdls{};
-
-	void Render::Service::batchRenderObject() {
+	void Render::Service::executeCommand(RenderCommand const& cmd) {
+		switch (cmd.type) {
+		case CommandType::TEXTURE:
+			drawTexture(render_queue.getTexture(cmd.payload));
+			break;
+		case CommandType::SHAPE:
+			drawShape(render_queue.getShape(cmd.payload));
+			break;
+		case CommandType::BOUNDING_BOX: {
+			auto const& box = render_queue.getBoundingBox(cmd.payload);
+			renderBoundingBox(box.xform, box.color);
+			break;
+		}
+		case CommandType::VIDEO:
+			drawVideo(render_queue.getVideo(cmd.payload));
+			break;
+		case CommandType::TEXT: {
+			auto const& text = render_queue.getText(cmd.payload);
+			renderText(text.xform, *text.text);
+			break;
+		}
+		case CommandType::PARTICLE: {
+			auto const& particle = render_queue.getParticle(cmd.payload);
+			renderParticleSystem(*particle.system, particle.use_screen_pos, particle.system->texture_ref);
+			break;
+		}
+		default:
+			break;
+		}
+	}
 
-		if (!BATCHED_RENDERING || render_instances_quad.empty()) {
+	void Render::Service::flushBatches() {
+		if (!BATCHED_RENDERING) {
 			return;
 		}
 
-		Assets::Model& model = *NIKE_ASSETS_SERVICE->getAsset<Assets::Model>("batched_square.model");
-
-		// create buffer of vertices
-		std::vector<Assets::Vertex> vertices;
+		batchRenderTextures();
+		batchRenderObject();
+		batchRenderBoundingBoxes();
+	}
 
-		vertices.reserve(render_instances_quad.size() * NUM_VERTICES_IN_MODEL);
+	/*****************************************************************//**
+	* BATCH RENDERING
+	*********************************************************************/
 
-		for (size_t i{}; i < render_instances_quad.size(); i++) {
-			//Modify the vertices directly without copying the model repeatedly
-			for (Assets::Vertex& v : model.vertices) {
-				Assets::Vertex temp = v; // Work on a temporary copy
-				temp.col = render_instances_quad[i].color;
-				temp.transform = render_instances_quad[i].xform;
-				vertices.push_back(temp);
+	unsigned int Render::Service::getBatchTextureSlot(unsigned int tex_hdl) {
+		// texture already bound for this batch
+		for (unsigned int i{}; i < batch_tex_count; i++) {
+			if (batch_tex_hdls[i] == tex_hdl) {
+				return i;
 			}
-
-			// create temp model to populate with current instance's data
-			//Assets::Model m{ model };
-			//for (Assets::Vertex& v : m.vertices) {
-			//	v.col = render_instances_quad[i].color;
-			//	v.transform = render_instances_quad[i].xform;
-			//}
-			//vertices.insert(vertices.end(), m.vertices.begin(), m.vertices.end());
 		}
 
-		// Update the vertex buffer object (VBO)
-		glNamedBufferSubData(model.vboid, 0, vertices.size() * sizeof(Assets::Vertex), vertices.data());
+		// all sampler slots taken, draw current batch first
+		if (batch_tex_count >= static_cast<unsigned int>(MAX_UNIQUE_TEX_HDLS)) {
+			batchRenderTextures();
+		}
 
-		// Create buffer of indices for indexed rendering
-		std::vector<unsigned int> indices;
+		batch_tex_hdls[batch_tex_count] = tex_hdl;
+		return batch_tex_count++;
+	}
 
-		indices.reserve(render_instances_quad.size() * NUM_INDICES_FOR_QUAD); // Adjust based on expected batch size
+	void Render::Service::batchRenderObject() {
 
-		// 0 1 2 2 3 0 -> 4 5 6 6 7 4
-		for (size_t i{}; i < render_instances_quad.size(); i++) {
-			unsigned int baseOffset = static_cast<unsigned int>(i * NUM_VERTICES_IN_MODEL);
-			for (unsigned int idx : model.indices) {
-				indices.push_back(idx + baseOffset);
-			}
-			//for (size_t j{}; j < model.indices.size(); j++) {
-			//	indices.push_back(model.indices[j] + baseOffset);
-			//	
-			//}
+		if (!BATCHED_RENDERING || render_instances_quad.empty()) {
+			return;
 		}
 
-		// Update the element buffer object (EBO)
-		glNamedBufferSubData(model.eboid, 0, indices.size() * sizeof(unsigned int), indices.data());
+		Assets::Model& model = *NIKE_ASSETS_SERVICE->getAsset<Assets::Model>("batched_square.model"_sid);
+
+		// pack instances straight into the mapped ring
+		const GLsizei instance_count = static_cast<GLsizei>(render_instances_quad.size());
+		unsigned int base_instance{};
+		InstancePacking::packInstances(render_instances_quad, instance_ring.allocate(instance_count, base_instance));
 
 		// use shader
 		shader_manager->useShader("batched_base");
 
 		// bind vao
+		instance_ring.bind(model.vaoid);
 		glBindVertexArray(model.vaoid);
 
-		// Draw all instances using instanced rendering
-		glDrawElementsInstanced(model.primitive_type, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(render_instances_quad.size()));
+		// Draw all instances using the static quad
+		glDrawElementsInstancedBaseInstance(model.primitive_type, model.draw_count, GL_UNSIGNED_INT, nullptr, instance_count, base_instance);
 
 		// cleanup
 		glBindVertexArray(0);
@@ -1239,63 +1235,26 @@ namespace NIKE {
 			return;
 		}
 
-		Assets::Model& model = *NIKE_ASSETS_SERVICE->getAsset<Assets::Model>("batched_square.model");
-
-		// Create a buffer for vertices
-		std::vector<Assets::Vertex> vertices;
-		vertices.reserve(render_instances_bounding_box.size() * NUM_VERTICES_IN_MODEL);
-
-		for (const auto& instance : render_instances_bounding_box) {
-			for (Assets::Vertex v : model.vertices) {
-				// Modify a temporary vertex with the instance data
-				v.col = instance.color;
-				v.transform = instance.xform;
-				vertices.push_back(v);
-			}
-		}
-
-		// Update the vertex buffer object (VBO)
-		glNamedBufferSubData(model.vboid, 0, vertices.size() * sizeof(Assets::Vertex), vertices.data());
-
-		// Create a buffer for indices
-		std::vector<unsigned int> indices;
-		indices.reserve(render_instances_bounding_box.size() * 8); // 8 indices per bounding box
-
-		for (size_t i = 0; i < render_instances_bounding_box.size(); ++i) {
-			unsigned int baseOffset = static_cast<unsigned int>(i * 4); // 4 vertices per bounding box
-
-			// Define edges manually for GL_LINES
-			indices.push_back(baseOffset + 0); indices.push_back(baseOffset + 1); // Bottom edge
-			indices.push_back(baseOffset + 1); indices.push_back(baseOffset + 2); // Right edge
-			indices.push_back(baseOffset + 2); indices.push_back(baseOffset + 3); // Top edge
-			indices.push_back(baseOffset + 3); indices.push_back(baseOffset + 0); // Left edge
-		}
+		Assets::Model& model = *NIKE_ASSETS_SERVICE->getAsset<Assets::Model>("batched_square.model"_sid);
 
-		// Update the element buffer object (EBO)
-		glNamedBufferSubData(model.eboid, 0, indices.size() * sizeof(unsigned int), indices.data());
+		// pack instances straight into the mapped ring
+		const GLsizei instance_count = static_cast<GLsizei>(render_instances_bounding_box.size());
+		unsigned int base_instance{};
+		InstancePacking::packInstances(render_instances_bounding_box, instance_ring.allocate(instance_count, base_instance));
 
 		// Use the wireframe shader
 		shader_manager->useShader("batched_base");
 
-		// Set polygon mode for wireframe
-		glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-
 		// Bind the VAO
+		instance_ring.bind(model.vaoid);
 		glBindVertexArray(model.vaoid);
 
-		// Draw all bounding box instances
-		glDrawElements(GL_LINES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, nullptr);
+		// Quad vertices are stored in winding order, draw them as a line loop per instance
+		glDrawArraysInstancedBaseInstance(GL_LINE_LOOP, 0, NUM_VERTICES_IN_MODEL, instance_count, base_instance);
 
 		// Cleanup
 		glBindVertexArray(0);
 		shader_manager->unuseShader();
-
-		// Reset polygon mode
-		glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-
-		// Clear the batch
-		glBindVertexArray(0);
-		shader_manager->unuseShader();
 		render_instances_bounding_box.clear();
 	}
 
@@ -1306,114 +1265,51 @@ namespace NIKE {
 		}
 
 		if (!BATCHED_RENDERING || render_instances_texture.empty()) {
+			batch_tex_count = 0;
 			return;
 		}
 
-		Assets::Model& model = *NIKE_ASSETS_SERVICE->getAsset<Assets::Model>("batched_texture.model");
-
-		// create vector of texture handles
-		// map with texture handle as key and binding unit as value
-		// not using unordered_map as it uses hashingand i need the index
-		std::map<unsigned int, unsigned int> texture_binding_unit_map;
-
-		// Bind textures and build the map
-		for (const auto& instance : render_instances_texture) {
-			if (texture_binding_unit_map.find(instance.tex) == texture_binding_unit_map.end()) {
-				// binding unit for this texture does not exist yet
-
-				// get binding unit. size of texture_binding_unit_map is the next available binding unit(size changes during this loop)
-				// cant use `i` as the max texture unit (at least on my system) is 32
-				const unsigned int binding_unit = static_cast<unsigned int>(texture_binding_unit_map.size());
-				const unsigned int tex_hdl = instance.tex;
-
-				// bind texture to binding unit
-				glBindTextureUnit(static_cast<unsigned int>(binding_unit), tex_hdl);
-
-				// store binding unit in map
-				texture_binding_unit_map[tex_hdl] = binding_unit;
-
-				// set texture parameters
-				glTextureParameteri(tex_hdl, GL_TEXTURE_WRAP_S, GL_REPEAT);
-				glTextureParameteri(tex_hdl, GL_TEXTURE_WRAP_T, GL_REPEAT);
-			}
-		}
-
-		// raw vector of binding units
-		std::vector<unsigned int> texture_binding_units;
-		std::transform(texture_binding_unit_map.begin(), texture_binding_unit_map.end(), std::back_inserter(texture_binding_units), [](const std::pair<unsigned int, unsigned int>& pair) { return pair.second; });
-
-		// create buffer of vertices
-		std::vector<Assets::Vertex> vertices;
-		vertices.reserve(render_instances_quad.size() * NUM_VERTICES_IN_MODEL);
+		Assets::Model& model = *NIKE_ASSETS_SERVICE->getAsset<Assets::Model>("batched_texture.model"_sid);
 
-		// Populate vertices
-		for (const auto& instance : render_instances_texture) {
-			// create temp model to populate with current instance's data
-			for (const Assets::Vertex& v : model.vertices) {
-				Assets::Vertex temp = v; // Work on a temporary copy
-				temp.transform = instance.xform;
-				temp.framesize = instance.framesize;
-				temp.uv_offset = instance.uv_offset;
-				temp.to_blend_color = instance.to_blend_color ? 1.0f : 0.0f;
+		// bind textures to the slots assigned while queueing
+		for (unsigned int binding_unit{}; binding_unit < batch_tex_count; binding_unit++) {
+			const unsigned int tex_hdl = batch_tex_hdls[binding_unit];
 
-				if (temp.to_blend_color) {
-					temp.col = instance.color;
-					temp.blend_intensity = instance.blend_intensity;
-				}
-
-				// get index of texture hdl in texture_binding_unit_map vector
-				auto it = texture_binding_unit_map.find(instance.tex);
-				if (it == texture_binding_unit_map.end()) {
-					NIKEE_CORE_ERROR("Texture handle not found in texture_binding_unit_map");
-					throw std::runtime_error("Invalid texture handle");
-				}
+			// bind texture to binding unit
+			glBindTextureUnit(binding_unit, tex_hdl);
 
-				temp.sampler_idx = static_cast<float>(std::distance(texture_binding_unit_map.begin(), it));
-				vertices.push_back(temp);
-			}
+			// set texture parameters
+			glTextureParameteri(tex_hdl, GL_TEXTURE_WRAP_S, GL_REPEAT);
+			glTextureParameteri(tex_hdl, GL_TEXTURE_WRAP_T, GL_REPEAT);
 		}
 
-		// populate vbo
-		glNamedBufferSubData(model.vboid, 0, vertices.size() * sizeof(Assets::Vertex), vertices.data());
-
-		// create buffer of indices for indexed rendering
-		std::vector<unsigned int> indices;
-		indices.reserve(render_instances_quad.size() * NUM_INDICES_FOR_QUAD);
-
-		// 0 1 2 2 3 0 -> 4 5 6 6 7 4
-		for (size_t i = 0; i < render_instances_texture.size(); i++) {
-			unsigned int baseOffset = static_cast<unsigned int>(i * NUM_VERTICES_IN_MODEL);
-			for (unsigned int idx : model.indices) {
-				indices.push_back(idx + baseOffset);
-			}
-		}
+		// bind runtime atlas after the standalone texture slots
+		glBindTextureUnit(ATLAS_TEXTURE_UNIT, NIKE_ASSETS_SERVICE->getTextureAtlas());
 
-		// populate ebo
-		glNamedBufferSubData(model.eboid, 0, indices.size() * sizeof(unsigned int), indices.data());
+		// pack instances straight into the mapped ring
+		const GLsizei instance_count = static_cast<GLsizei>(render_instances_texture.size());
+		unsigned int base_instance{};
+		InstancePacking::packInstances(render_instances_texture, instance_ring.allocate(instance_count, base_instance));
 
 		// use shader
 		shader_manager->useShader("batched_texture");
 
 		// set uniform
-		shader_manager->setUniform("batched_texture", "u_tex2d", texture_binding_units);
+		shader_manager->setUniform("batched_texture", "u_tex2d", batch_tex_units);
+		shader_manager->setUniform("batched_texture", "u_atlas", ATLAS_TEXTURE_UNIT);
 
 		// bind vao
+		instance_ring.bind(model.vaoid);
 		glBindVertexArray(model.vaoid);
 
-		// Draw all instances using instanced rendering
-		glDrawElementsInstanced(model.primitive_type, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(render_instances_texture.size()));
-
-		// check framebuffer
-		//glBindFramebuffer(GL_FRAMEBUFFER, 0);
-		//GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
-		//if (status != GL_FRAMEBUFFER_COMPLETE) {
-		//	NIKEE_CORE_ERROR("Incomplete framebuffer in {0} with status: {1}", __FUNCTION__, status);
-		//}
+		// Draw all instances using the static quad
+		glDrawElementsInstancedBaseInstance(model.primitive_type, model.draw_count, GL_UNSIGNED_INT, nullptr, instance_count, base_instance);
 
 		// cleanup
 		glBindVertexArray(0);
 		shader_manager->unuseShader();
 		render_instances_texture.clear();
+		batch_tex_count = 0;
 
 		err = glGetError();
 		if (err != GL_NO_ERROR) {
@@ -1429,55 +1325,28 @@ namespace NIKE {
 		//Update particle manager
 		//particle_manager->update();
 
-		//Render world elements
-		while (!world_render_queue.empty()) {
-			world_render_queue.front()();
-			world_render_queue.pop();
-		}
-
-		//Batch render
-		if (NIKE_RENDER_SERVICE->BATCHED_RENDERING) {
-			NIKE_RENDER_SERVICE->batchRenderTextures();
-			NIKE_RENDER_SERVICE->batchRenderObject();
-			NIKE_RENDER_SERVICE->batchRenderBoundingBoxes();
-		}
-
-		//Render world text elements
-		while (!world_text_render_queue.empty()) {
-			world_text_render_queue.front()();
-			world_text_render_queue.pop();
-		}
+		//Sort commands, depth keeps submission order within each pass
+		render_queue.sort();
 
-		//Render world particle elements
-		while (!world_particle_render_queue.empty()) {
-			world_particle_render_queue.front()();
-			world_particle_render_queue.pop();
-		}
+		//Execute commands in key order
+		std::optional<RenderPass> curr_pass;
+		for (auto const& cmd : render_queue.getCommands()) {
 
-		//Render screen elements
-		while (!screen_render_queue.empty()) {
-			screen_render_queue.front()();
-			screen_render_queue.pop();
-		}
+			//Batches of the previous pass are drawn before the next pass starts
+			const RenderPass pass = SortKey::getPass(cmd.key);
+			if (curr_pass.has_value() && curr_pass.value() != pass) {
+				flushBatches();
+			}
+			curr_pass = pass;
 
-		//Batch render
-		if (NIKE_RENDER_SERVICE->BATCHED_RENDERING) {
-			NIKE_RENDER_SERVICE->batchRenderTextures();
-			NIKE_RENDER_SERVICE->batchRenderObject();
-			NIKE_RENDER_SERVICE->batchRenderBoundingBoxes();
+			executeCommand(cmd);
 		}
 
-		//Render screen text elements
-		while (!screen_text_render_queue.empty()) {
-			screen_text_render_queue.front()();
-			screen_text_render_queue.pop();
-		}
+		//Batch render remaining instances
+		flushBatches();
 
-		//Render screen particle elements
-		while (!screen_particle_render_queue.empty()) {
-			screen_particle_render_queue.front()();
-			screen_particle_render_queue.pop();
-		}
+		//Clear commands for next frame
+		render_queue.clear();
 
 		// render from fbo
 
@@ -1518,7 +1387,7 @@ namespace NIKE {
 			//shader_manager->setUniform("texture", "u_flipvertical", e_texture.b_flip.y);
 
 			//Get model
-			auto& model = *NIKE_ASSETS_SERVICE->getAsset<Assets::Model>("square-texture.model");
+			auto& model = *NIKE_ASSETS_SERVICE->getAsset<Assets::Model>("square-texture.model"_sid);
 
 			//Draw
 			glClear(GL_COLOR_BUFFER_BIT);
@@ -1541,6 +1410,11 @@ namespace NIKE {
 				break;
 			}
 		}
+
+		// instance data written this frame is fenced, next frame writes to the next ring segment
+		if (BATCHED_RENDERING) {
+			instance_ring.advance();
+		}
 	}
 
 	void Render::Service::fadeIn(float duration) {
@@ -0,0 +1,73 @@
+/*****************************************************************//**
+ * \file   sRenderQueue.cpp
+ * \brief  Sort key render command queue
+ *
+ * \author agent, agent@local (100%)
+ * \date   October 2026
+ * All content © 2026 DigiPen Institute of Technology Singapore, all rights reserved.
+ *********************************************************************/
+
+#include "Core/stdafx.h"
+#include "Managers/Services/Render/sRenderQueue.h"
+
+namespace NIKE {
+
+	void Render::radixSortCommands(std::vector<RenderCommand>& commands, std::vector<RenderCommand>& scratch) {
+		static constexpr int DIGIT_BITS = 8;
+		static constexpr int NUM_DIGITS = 64 / DIGIT_BITS;
+		static constexpr size_t NUM_BUCKETS = size_t(1) << DIGIT_BITS;
+
+		if (commands.size() < 2) {
+			return;
+		}
+
+		//Histogram of every digit in one pass
+		std::array<std::array<size_t, NUM_BUCKETS>, NUM_DIGITS> histograms{};
+		for (auto const& cmd : commands) {
+			for (int digit = 0; digit < NUM_DIGITS; ++digit) {
+				++histograms[digit][(cmd.key >> (digit * DIGIT_BITS)) & (NUM_BUCKETS - 1)];
+			}
+		}
+
+		scratch.resize(commands.size());
+
+		for (int digit = 0; digit < NUM_DIGITS; ++digit) {
+			auto& histogram = histograms[digit];
+
+			//Every key has the same value for this digit, order is unchanged
+			if (histogram[(commands.front().key >> (digit * DIGIT_BITS)) & (NUM_BUCKETS - 1)] == commands.size()) {
+				continue;
+			}
+
+			//Bucket offsets
+			size_t offset = 0;
+			for (auto& count : histogram) {
+				const size_t bucket_count = count;
+				count = offset;
+				offset += bucket_count;
+			}
+
+			//Scatter
+			for (auto const& cmd : commands) {
+				scratch[histogram[(cmd.key >> (digit * DIGIT_BITS)) & (NUM_BUCKETS - 1)]++] = cmd;
+			}
+
+			commands.swap(scratch);
+		}
+	}
+
+	void Render::RenderQueue::sort() {
+		radixSortCommands(commands, scratch);
+	}
+
+	void Render::RenderQueue::clear() {
+		commands.clear();
+		textures.clear();
+		shapes.clear();
+		bounding_boxes.clear();
+		videos.clear();
+		texts.clear();
+		particles.clear();
+		depth = 0;
+	}
+}
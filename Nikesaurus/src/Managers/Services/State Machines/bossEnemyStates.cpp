@@ -128,7 +128,7 @@ namespace NIKE {
 			}
 
 			// Look for entity w player component
-			for (auto& player : NIKE_METADATA_SERVICE->getEntitiesByTag("player")) {
+			for (auto& player : NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid)) {
 				// Look for entity w player component, do like this first, when meta data is out, no need iterate through
 				auto e_player_comp = NIKE_ECS_MANAGER->getEntityComponent<GameLogic::ILogic>(player);
 				// If player entity exists
@@ -272,7 +272,7 @@ namespace NIKE {
 
 	void State::BossChaseState::onUpdate([[maybe_unused]] Entity::Type& entity)
 	{
-		if (NIKE_METADATA_SERVICE->getEntitiesByTag("player").empty())
+		if (NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid).empty())
 		{
 			// Stop SFX when walking
 			auto e_audio_comp = NIKE_ECS_MANAGER->getEntityComponent<Audio::SFX>(entity);
@@ -282,7 +282,7 @@ namespace NIKE {
 			}
 		}
 
-		for (auto& other_entity : NIKE_METADATA_SERVICE->getEntitiesByTag("player"))
+		for (auto& other_entity : NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid))
 		{
 			// Getting components from player and enemy entities
 			auto e_player_game_logic = NIKE_ECS_MANAGER->getEntityComponent<GameLogic::ILogic>(other_entity);
@@ -485,11 +485,11 @@ namespace NIKE {
 		// cout << "update Idle State" << endl;
 		auto animation_comp = NIKE_ECS_MANAGER->getEntityComponent<Animation::Base>(entity);
 		// Delete healthbar entities as well
-		for (auto healthbar : NIKE_METADATA_SERVICE->getEntitiesByTag("bosshpcontainer"))
+		for (auto healthbar : NIKE_METADATA_SERVICE->getEntitiesByTag("bosshpcontainer"_sid))
 		{
 			NIKE_METADATA_SERVICE->destroyEntity(healthbar);
 		}
-		for (auto healthbar : NIKE_METADATA_SERVICE->getEntitiesByTag("boss_healthbar"))
+		for (auto healthbar : NIKE_METADATA_SERVICE->getEntitiesByTag("boss_healthbar"_sid))
 		{
 			NIKE_METADATA_SERVICE->destroyEntity(healthbar);
 		}
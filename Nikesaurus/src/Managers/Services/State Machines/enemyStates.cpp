@@ -133,7 +133,7 @@ namespace NIKE {
 			}
 
 			// Look for entity w player component
-			for (auto& other_entity : NIKE_METADATA_SERVICE->getEntitiesByTag("player")) {
+			for (auto& other_entity : NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid)) {
 				// Look for entity w player component, do like this first, when meta data is out, no need iterate through
 				auto e_player_comp = NIKE_ECS_MANAGER->getEntityComponent<GameLogic::ILogic>(other_entity);
 				// If player entity exists
@@ -268,7 +268,7 @@ namespace NIKE {
 
 	void State::EnemyChaseState::onUpdate(Entity::Type& entity)
 	{
-		if (NIKE_METADATA_SERVICE->getEntitiesByTag("player").empty())
+		if (NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid).empty())
 		{
 			// Stop SFX when walking
 			auto e_audio_comp = NIKE_ECS_MANAGER->getEntityComponent<Audio::SFX>(entity);
@@ -278,7 +278,7 @@ namespace NIKE {
 			}
 		}
 
-		for (auto& other_entity : NIKE_METADATA_SERVICE->getEntitiesByTag("player"))
+		for (auto& other_entity : NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid))
 		{
 			// Getting components from player and enemy entities
 			auto e_player_game_logic = NIKE_ECS_MANAGER->getEntityComponent<GameLogic::ILogic>(other_entity);
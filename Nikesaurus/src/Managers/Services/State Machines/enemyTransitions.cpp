@@ -72,7 +72,7 @@ namespace NIKE {
 	bool Transition::IdleToEnemyAttack::isValid(Entity::Type& entity) const
 	{
 		// Look for entity w player component, do like this first, when meta data is out, no need iterate through
-		for (auto& player : NIKE_METADATA_SERVICE->getEntitiesByTag("player")) {
+		for (auto& player : NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid)) {
 			auto e_player_comp = NIKE_ECS_MANAGER->getEntityComponent<GameLogic::ILogic>(player);
 			// Somehow e_player_comp is getting nullptr
 			if (e_player_comp.has_value())
@@ -101,7 +101,7 @@ namespace NIKE {
 	{
 		// This function will check if there is a path from player to enemy entity(param)
 		// Look for entity w player component, do like this first, when meta data is out, no need iterate through
-		for (auto& player : NIKE_METADATA_SERVICE->getEntitiesByTag("player")) {
+		for (auto& player : NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid)) {
 			// Getting comps
 			auto e_player_comp = NIKE_ECS_MANAGER->getEntityComponent<GameLogic::ILogic>(player);
 			auto e_player_transform = NIKE_ECS_MANAGER->getEntityComponent<Transform::Transform>(player);
@@ -124,32 +124,40 @@ namespace NIKE {
 					continue;
 				}
 
+				// Player directly visible, chase without searching for a path
+				if (NIKE_MAP_SERVICE->hasLineOfSight(start.value(), end.value())) {
+					if (!Enemy::isWithinGridRange(entity, player)) {
+						return true;
+					}
+					continue;
+				}
+
 				// If path exist, transition to EnemyChaseState
 				// Check conditions that would trigger transition to EnemyChaseState state
 				// Find path for player
 				if (!NIKE_MAP_SERVICE->checkPath(entity) ||
 
-					//Condition if changes to grid blocked has been made
-					NIKE_MAP_SERVICE->checkGridChanged() ||
+					//Condition if blocked cells changed along current path
+					NIKE_MAP_SERVICE->isPathAffected(entity) ||
 
 					//Check if target got shifted
-					(NIKE_MAP_SERVICE->getPath(entity).goal.index != end.value()) ||
+					(NIKE_MAP_SERVICE->getPath(entity).goal != end.value()) ||
 
 					//Check if entity got shifted
 					(!NIKE_MAP_SERVICE->getPath(entity).path.empty() &&
-						(std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().index.x - start.value().x) > 1 ||
-							std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().index.y - start.value().y) > 1)) ||
+						(std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().x - start.value().x) > 1 ||
+							std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().y - start.value().y) > 1)) ||
 
 					//Check if path is finished & entity got shifted
-					(NIKE_MAP_SERVICE->getPath(entity).b_finished && start.value() != NIKE_MAP_SERVICE->getPath(entity).end.index)
+					(NIKE_MAP_SERVICE->getPath(entity).b_finished && start.value() != NIKE_MAP_SERVICE->getPath(entity).end)
 
 					) {
-					NIKE_MAP_SERVICE->findPath(entity, start.value(), end.value());
+					NIKE_MAP_SERVICE->requestPath(entity, start.value(), end.value());
 				}
 
 				// Transition happens when path is not empty
-				auto path = NIKE_MAP_SERVICE->getPath(entity);
-				if (!path.path.empty() && !Enemy::isWithinGridRange(entity, player) && !NIKE_METADATA_SERVICE->getEntitiesByTag("player").empty()) {
+				auto const& path = NIKE_MAP_SERVICE->getPath(entity);
+				if (!path.path.empty() && !Enemy::isWithinGridRange(entity, player) && !NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid).empty()) {
 					return true;
 				}
 			}
@@ -192,7 +200,7 @@ namespace NIKE {
 	bool Transition::EnemyAttackToIdle::isValid(Entity::Type& entity) const
 	{
 		// Look for entity w player component, do like this first, when meta data is out, no need iterate through
-		for (auto& player : NIKE_METADATA_SERVICE->getEntitiesByTag("player")) {
+		for (auto& player : NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid)) {
 			auto e_player_comp = NIKE_ECS_MANAGER->getEntityComponent<GameLogic::ILogic>(player);
 			if (e_player_comp.has_value())
 			{
@@ -219,7 +227,7 @@ namespace NIKE {
 	bool Transition::EnemyAttackToEnemyChase::isValid(Entity::Type& entity) const
 	{
 		// This function will check if there is a path from player to enemy entity(param)
-		for (auto& player : NIKE_METADATA_SERVICE->getEntitiesByTag("player")) {
+		for (auto& player : NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid)) {
 			// Getting comps
 			auto e_player_comp = NIKE_ECS_MANAGER->getEntityComponent<GameLogic::ILogic>(player);
 			auto e_player_transform = NIKE_ECS_MANAGER->getEntityComponent<Transform::Transform>(player);
@@ -240,31 +248,39 @@ namespace NIKE {
 					continue;
 				}
 
+				// Player directly visible, chase without searching for a path
+				if (NIKE_MAP_SERVICE->hasLineOfSight(start.value(), end.value())) {
+					if (!Enemy::isWithinGridRange(entity, player)) {
+						return true;
+					}
+					continue;
+				}
+
 				// If path exist, transition to EnemyChaseState
 				// Check conditions that would trigger transition to EnemyChaseState state
 				// Find path for player
 				if (!NIKE_MAP_SERVICE->checkPath(entity) ||
 
-					//Condition if changes to grid blocked has been made
-					NIKE_MAP_SERVICE->checkGridChanged() ||
+					//Condition if blocked cells changed along current path
+					NIKE_MAP_SERVICE->isPathAffected(entity) ||
 
 					//Check if target got shifted
-					(NIKE_MAP_SERVICE->getPath(entity).goal.index != end.value()) ||
+					(NIKE_MAP_SERVICE->getPath(entity).goal != end.value()) ||
 
 					//Check if entity got shifted
 					(!NIKE_MAP_SERVICE->getPath(entity).path.empty() &&
-						(std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().index.x - start.value().x) > 1 ||
-							std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().index.y - start.value().y) > 1)) ||
+						(std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().x - start.value().x) > 1 ||
+							std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().y - start.value().y) > 1)) ||
 
 					//Check if path is finished & entity got shifted
-					(NIKE_MAP_SERVICE->getPath(entity).b_finished && start.value() != NIKE_MAP_SERVICE->getPath(entity).end.index)
+					(NIKE_MAP_SERVICE->getPath(entity).b_finished && start.value() != NIKE_MAP_SERVICE->getPath(entity).end)
 
 					) {
-					NIKE_MAP_SERVICE->findPath(entity, start.value(), end.value());
+					NIKE_MAP_SERVICE->requestPath(entity, start.value(), end.value());
 				}
 
 				// Transition happens when path is not empty
-				auto path = NIKE_MAP_SERVICE->getPath(entity);
+				auto const& path = NIKE_MAP_SERVICE->getPath(entity);
 				if (!path.path.empty() && !Enemy::isWithinGridRange(entity, player)) {
 					return true;
 				}
@@ -308,7 +324,7 @@ namespace NIKE {
 	bool Transition::EnemyChaseToEnemyAttack::isValid(Entity::Type& entity) const
 	{
 		// Look for entity w player component, do like this first, when meta data is out, no need iterate through
-		for (auto& other_entity : NIKE_METADATA_SERVICE->getEntitiesByTag("player")) {
+		for (auto& other_entity : NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid)) {
 			auto e_player_comp = NIKE_ECS_MANAGER->getEntityComponent<GameLogic::ILogic>(other_entity);
 			if (e_player_comp.has_value())
 			{
@@ -336,14 +352,14 @@ namespace NIKE {
 	{
 		// This function will check if there is a path from player to enemy entity(param)
 		// Look for entity w player component, do like this first, when meta data is out, no need iterate through
-		for (auto& player : NIKE_METADATA_SERVICE->getEntitiesByTag("player")) {
+		for (auto& player : NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid)) {
 			// Getting comps
 			auto e_player_comp = NIKE_ECS_MANAGER->getEntityComponent<GameLogic::ILogic>(player);
 
 			if (e_player_comp.has_value())
 			{
 				// Transition happens when path is not empty
-				auto path = NIKE_MAP_SERVICE->getPath(entity);
+				auto const& path = NIKE_MAP_SERVICE->getPath(entity);
 				if (path.path.empty()) {
 					return true;
 				}
@@ -490,22 +506,22 @@ namespace NIKE {
 	//				NIKE_MAP_SERVICE->checkGridChanged() ||
 
 	//				//Check if target got shifted
-	//				(NIKE_MAP_SERVICE->getPath(entity).goal.index != end.value()) ||
+	//				(NIKE_MAP_SERVICE->getPath(entity).goal != end.value()) ||
 
 	//				//Check if entity got shifted
 	//				(!NIKE_MAP_SERVICE->getPath(entity).path.empty() &&
-	//					(std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().index.x - start.value().x) > 1 ||
-	//						std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().index.y - start.value().y) > 1)) ||
+	//					(std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().x - start.value().x) > 1 ||
+	//						std::abs(NIKE_MAP_SERVICE->getPath(entity).path.front().y - start.value().y) > 1)) ||
 
 	//				//Check if path is finished & entity got shifted
-	//				(NIKE_MAP_SERVICE->getPath(entity).b_finished && start.value() != NIKE_MAP_SERVICE->getPath(entity).end.index)
+	//				(NIKE_MAP_SERVICE->getPath(entity).b_finished && start.value() != NIKE_MAP_SERVICE->getPath(entity).end)
 
 	//				) {
 	//				NIKE_MAP_SERVICE->findPath(entity, start.value(), end.value());
 	//			}
 
 	//			// Transition happens when path is not empty
-	//			auto path = NIKE_MAP_SERVICE->getPath(entity);
+	//			auto const& path = NIKE_MAP_SERVICE->getPath(entity);
 	//			if (!path.path.empty() && !Enemy::isWithinGridRange(entity, player) && !health_comp.value().get().taken_damage) {
 	//				return true;
 	//			}
@@ -34,6 +34,36 @@ namespace NIKE {
 				// Get start index
 				auto& start_index = start.value();
 
+				// Follow shared flow field toward goal ( rebuilt once per goal or grid change, not per enemy )
+				Vector2i goal{ x_index, y_index };
+				NIKE_MAP_SERVICE->updateFlowField(goal);
+				auto flow_step = NIKE_MAP_SERVICE->getFlowStep(start_index);
+				if (flow_step.has_value() || start_index == goal) {
+					Vector2i next_index = flow_step.value_or(goal);
+					float distance = (NIKE_MAP_SERVICE->getCellPosition(next_index) - e_transform.position).length();
+
+					auto dynamics = NIKE_ECS_MANAGER->getEntityComponent<Physics::Dynamics>(entity);
+					if (!dynamics.has_value()) return;
+
+					// Stop moving when close to the FINAL target
+					if (next_index == goal && distance < cell_offset * 1.5f) {
+						dynamics.value().get().force = { 0.0f, 0.0f };
+						return;
+					}
+
+					// Look one cell further once the entity reaches the next cell
+					if (distance < cell_offset) {
+						next_index = NIKE_MAP_SERVICE->getFlowStep(next_index).value_or(goal);
+					}
+
+					Vector2f next_target = NIKE_MAP_SERVICE->getCellPosition(next_index);
+					float dir = atan2((next_target.y - e_transform.position.y),
+						(next_target.x - e_transform.position.x));
+					dynamics.value().get().force = { cos(dir) * speed, sin(dir) * speed };
+					return;
+				}
+
+				// Goal unreachable from here, fall back to queued A* toward the closest reachable cell ( previous path is followed until it arrives )
 				static float path_recalc_timer = 0.0f;
 				path_recalc_timer += NIKE_WINDOWS_SERVICE->getFixedDeltaTime();
 				static int path_stick_threshold = 5; // How many frames to stick to a path
@@ -41,10 +71,10 @@ namespace NIKE {
 
 				// Check if path has been generated or if destination cell has changed
 				if (!NIKE_MAP_SERVICE->checkPath(entity) ||
-					NIKE_MAP_SERVICE->checkGridChanged() ||
+					NIKE_MAP_SERVICE->isPathAffected(entity) ||
 					path_recalc_timer >= 0.5f) {
 					// Search for path
-					NIKE_MAP_SERVICE->findPath(entity, start_index, Vector2i(x_index, y_index));
+					NIKE_MAP_SERVICE->requestPath(entity, start_index, Vector2i(x_index, y_index));
 					path_follow_counter = 0;
 					path_recalc_timer = 0.0f;
 				}
@@ -52,17 +82,23 @@ namespace NIKE {
 					++path_follow_counter;
 				}
 
+				// Refine next cluster of long range paths before running out of cells
+				if (NIKE_MAP_SERVICE->getPath(entity).path.size() <= 1) {
+					NIKE_MAP_SERVICE->refinePath(entity);
+				}
+
 				// Get path
-				auto path = NIKE_MAP_SERVICE->getPath(entity);
+				auto const& path = NIKE_MAP_SERVICE->getPath(entity);
+				size_t next_step = 0;
 
 				// Check if there are cells left in path
 				if (!path.path.empty()) {
-					auto const& next_cell = path.path.front();
+					Vector2f next_cell = NIKE_MAP_SERVICE->getCellPosition(path.path[next_step]);
 
-					float distance = (next_cell.position - e_transform.position).length();
+					float distance = (next_cell - e_transform.position).length();
 
 					// Stop moving when close to the FINAL target
-					if (distance < cell_offset * 1.5f && path.path.size() == 1) {
+					if (distance < cell_offset * 1.5f && path.path.size() == 1 && path.waypoints.empty()) {
 						auto dynamics = NIKE_ECS_MANAGER->getEntityComponent<Physics::Dynamics>(entity);
 						if (dynamics.has_value()) {
 							dynamics.value().get().force = { 0.0f, 0.0f };
@@ -72,19 +108,19 @@ namespace NIKE {
 						return; 
 					}
 
-					// Remove the front of the path once the entity reaches it
+					// Skip the front of the path once the entity reaches it
 					if (distance < cell_offset) {
 						//cout << "Arrived at next cell, popping front" << endl;
-						path.path.pop_front();
+						++next_step;
 					}
 
 					// Normal movement logic
-					// Check again in case we removed the last step
-					if (!path.path.empty()) {  
-						auto const& next_target = path.path.front();
+					// Check again in case we skipped the last step
+					if (next_step < path.path.size()) {  
+						Vector2f next_target = NIKE_MAP_SERVICE->getCellPosition(path.path[next_step]);
 
-						float dir = atan2((next_target.position.y - e_transform.position.y),
-							(next_target.position.x - e_transform.position.x));
+						float dir = atan2((next_target.y - e_transform.position.y),
+							(next_target.x - e_transform.position.x));
 
 						auto dynamics = NIKE_ECS_MANAGER->getEntityComponent<Physics::Dynamics>(entity);
 						if (dynamics.has_value()) {
@@ -110,7 +146,7 @@ namespace NIKE {
 					//cout << "Path is stuck, recalculating..." << endl;
 					path_follow_counter = 0;
 					path_recalc_timer = 0.0f;
-					NIKE_MAP_SERVICE->findPath(entity, start_index, Vector2i(x_index, y_index));
+					NIKE_MAP_SERVICE->requestPath(entity, start_index, Vector2i(x_index, y_index));
 				}
 			}
 		}
@@ -143,8 +179,8 @@ namespace NIKE {
 				// Calculate the Manhattan distance (or use Euclidean if desired)
 				const int distance = dist_x + dist_y;
 
-				// Check if within the specified range (in grid cells)
-				return distance <= enemy_range;
+				// Check if within the specified range (in grid cells) & not behind walls
+				return distance <= enemy_range && NIKE_MAP_SERVICE->hasLineOfSight(enemy_cell.value(), player_cell.value());
 			}
 		}
 
@@ -261,6 +297,12 @@ namespace NIKE {
 			bullet_physics_comp.value().get().force = { direction.x, direction.y };
 		}
 
+		// Sweep bullet against broadphase so it cannot tunnel through thin colliders
+		auto bullet_collider_comp = NIKE_ECS_MANAGER->getEntityComponent<Physics::Collider>(bullet_entity);
+		if (bullet_collider_comp.has_value()) {
+			bullet_collider_comp.value().get().b_continuous = true;
+		}
+
 		// Set bullet SFX
 		auto bullet_sfx_opt = NIKE_ECS_MANAGER->getEntityComponent<Audio::SFX>(bullet_entity);
 		if (bullet_sfx_opt.has_value()) {
@@ -456,6 +498,12 @@ namespace NIKE {
 				bullet_physics.value().get().force = rotated_direction; 
 			}
 
+			// Sweep bullet against broadphase so it cannot tunnel through thin colliders
+			auto bullet_collider = NIKE_ECS_MANAGER->getEntityComponent<Physics::Collider>(bullet_entity);
+			if (bullet_collider.has_value()) {
+				bullet_collider.value().get().b_continuous = true;
+			}
+
 			// Bullet SFX
 			// Set bullet SFX
 			if (!sfxPlayed) {
@@ -49,6 +49,19 @@ namespace NIKE {
 		double Service::getTotalSystemTime() const {
 			return total_system_time;
 		}
+
+		void Service::updateRenderCulling(int visible_count, int culled_count) {
+			render_visible_count = visible_count;
+			render_culled_count = culled_count;
+		}
+
+		int Service::getRenderVisibleCount() const {
+			return render_visible_count;
+		}
+
+		int Service::getRenderCulledCount() const {
+			return render_culled_count;
+		}
 	}
 
 }
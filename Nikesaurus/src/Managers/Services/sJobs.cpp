@@ -0,0 +1,144 @@
+/*****************************************************************//**
+ * \file   sJobs.cpp
+ * \brief  Job system definitions
+ *
+ * \author agent, agent@local (100%)
+ * \date   October 2026
+ * All content © 2026 DigiPen Institute of Technology Singapore, all rights reserved.
+ *********************************************************************/
+#include "Core/stdafx.h"
+#include "Managers/Services/sJobs.h"
+
+namespace NIKE {
+
+	Jobs::Service::Service()
+		: job_func{ nullptr }, job_count{ 0 }, job_grain{ 1 }, job_next{ 0 }, job_generation{ 0 }, job_busy{ 0 }, b_shutdown{ false } {}
+
+	Jobs::Service::~Service() {
+		shutdown();
+	}
+
+	void Jobs::Service::init(size_t worker_count) {
+		if (!workers.empty()) {
+			throw std::runtime_error("Job service already initialized.");
+		}
+
+		//Default to one worker per hardware thread, leaving the calling thread free
+		if (worker_count == 0) {
+			unsigned int hardware_threads = std::thread::hardware_concurrency();
+			worker_count = hardware_threads > 1 ? hardware_threads - 1 : 0;
+		}
+
+		b_shutdown = false;
+		workers.reserve(worker_count);
+		for (size_t i = 0; i < worker_count; ++i) {
+			workers.emplace_back(&Service::workerLoop, this);
+		}
+
+		NIKEE_CORE_INFO("Job service started with {} worker threads", worker_count);
+	}
+
+	void Jobs::Service::shutdown() {
+		{
+			std::lock_guard<std::mutex> lock(job_mutex);
+			b_shutdown = true;
+		}
+		job_cv.notify_all();
+
+		for (auto& worker : workers) {
+			if (worker.joinable()) {
+				worker.join();
+			}
+		}
+		workers.clear();
+	}
+
+	size_t Jobs::Service::getWorkerCount() const {
+		return workers.size();
+	}
+
+	void Jobs::Service::runChunks() {
+		while (true) {
+			size_t begin = job_next.fetch_add(job_grain);
+			if (begin >= job_count) {
+				return;
+			}
+
+			try {
+				(*job_func)(begin, std::min(begin + job_grain, job_count));
+			}
+			catch (...) {
+				std::lock_guard<std::mutex> lock(job_mutex);
+				if (!job_exception) {
+					job_exception = std::current_exception();
+				}
+			}
+		}
+	}
+
+	void Jobs::Service::workerLoop() {
+		uint64_t last_generation = 0;
+
+		while (true) {
+			{
+				std::unique_lock<std::mutex> lock(job_mutex);
+				job_cv.wait(lock, [&]() { return b_shutdown || job_generation != last_generation; });
+				if (b_shutdown) {
+					return;
+				}
+				last_generation = job_generation;
+			}
+
+			runChunks();
+
+			{
+				std::lock_guard<std::mutex> lock(job_mutex);
+				if (--job_busy == 0) {
+					done_cv.notify_one();
+				}
+			}
+		}
+	}
+
+	void Jobs::Service::parallelFor(size_t count, size_t grain, RangeFunc const& func) {
+		grain = std::max<size_t>(grain, 1);
+
+		//Run inline when there is nothing to split
+		if (workers.empty() || count <= grain) {
+			if (count > 0) {
+				func(0, count);
+			}
+			return;
+		}
+
+		//Publish job
+		{
+			std::lock_guard<std::mutex> lock(job_mutex);
+			job_func = &func;
+			job_count = count;
+			job_grain = grain;
+			job_next.store(0);
+			job_busy = workers.size();
+			job_exception = nullptr;
+			++job_generation;
+		}
+		job_cv.notify_all();
+
+		//Calling thread helps out
+		runChunks();
+
+		//Wait for workers to finish their chunks
+		std::exception_ptr exception;
+		{
+			std::unique_lock<std::mutex> lock(job_mutex);
+			done_cv.wait(lock, [&]() { return job_busy == 0; });
+			job_func = nullptr;
+			exception = job_exception;
+			job_exception = nullptr;
+		}
+
+		if (exception) {
+			std::rethrow_exception(exception);
+		}
+	}
+}
@@ -12,89 +12,117 @@
 namespace NIKE {
 
 	Map::Service::Service() 
-		: grid_size{ DEFAULT_GRID_SIZE }, cell_size{ DEFAULT_CELL_SIZE }, cursor_pos{ 0.0f, 0.0f }, b_cell_changed{ false } {
+		: path_budget{ DEFAULT_PATH_BUDGET }, search_stamp{ 0 }, cluster_count{}, flow_goal{}, b_flow_diagonal{ false }, b_flow_valid{ false }, grid_generation{ 0 }, trimmed_generation{ 0 }, grid_size{ DEFAULT_GRID_SIZE }, cell_size{ DEFAULT_CELL_SIZE }, cursor_pos{ 0.0f, 0.0f }, b_cell_changed{ false } {
 
 		//Initialize grid
-		grid.resize(grid_size.y);
-		for (size_t i = 0; i < grid_size.y; ++i) {
-			grid.at(i).resize(grid_size.x);
-		}
+		resizeOccupancy({ 0, 0 });
 
-		updateCells();
+		updateGridScale();
 	}
 
 
 	void Map::Service::onEvent(std::shared_ptr<Coordinator::EntitiesChanged> event) {
 
-		//Update entity paths
-		for (auto it = paths.begin(); it != paths.end();) {
-			if (event->entities.find(it->first) == event->entities.end()) {
-				it = paths.erase(it);
-			}
-			else {
-				++it;
-			}
+		//Remove paths & pending requests of destroyed entities
+		for (auto entity : event->removed) {
+			paths.erase(entity);
+			path_requests.erase(entity);
 		}
 	}
 
-	void Map::Service::updateCells() {
-
+	void Map::Service::updateGridScale() {
 		grid_scale = { grid_size.x * cell_size.x, grid_size.y * cell_size.y };
+	}
+
+	void Map::Service::resizeOccupancy(Vector2i const& old_size) {
 
-		//Update cells with correct position
-		float top = (grid_scale.y / 2.0f);
-		for (int i = 0; i < grid_size.y; ++i) {
-			float left = -(grid_scale.x / 2.0f);
-			for (int j = 0; j < grid_size.x; ++j) {
-				grid.at(i).at(j).position = { left + (cell_size.x / 2.0f), top - (cell_size.y / 2.0f) };
-				grid.at(i).at(j).index = { j, i };
-				left += cell_size.x;
+		//Copy overlapping cells into resized bitmap
+		std::vector<uint64_t> resized((static_cast<size_t>(grid_size.x) * static_cast<size_t>(grid_size.y) + 63) / 64, 0);
+		for (int y = 0; y < Utility::getMin(old_size.y, grid_size.y); ++y) {
+			for (int x = 0; x < Utility::getMin(old_size.x, grid_size.x); ++x) {
+				int old_cell = y * old_size.x + x;
+				if ((occupancy[old_cell >> 6] >> (old_cell & 63)) & 1) {
+					int cell = y * grid_size.x + x;
+					resized[cell >> 6] |= uint64_t(1) << (cell & 63);
+				}
 			}
-			top -= cell_size.y;
+		}
+		occupancy = std::move(resized);
+
+		//Grid replaced, rebuild pathfinding data on next use
+		clusters.clear();
+		dirty_clusters.clear();
+		b_flow_valid = false;
+
+		//Whole grid counts as changed
+		pending_regions.clear();
+		if (grid_size.x > 0 && grid_size.y > 0) {
+			pending_regions.push_back({ { 0, 0 }, { grid_size.x - 1, grid_size.y - 1 }, 0 });
 		}
 	}
 
+	bool Map::Service::isBlockedAt(int cell) const {
+		return (occupancy[cell >> 6] >> (cell & 63)) & 1;
+	}
+
 	void Map::Service::onEvent(std::shared_ptr<Input::MouseMovedEvent> event) {
 		cursor_pos = event->world_pos;
 	}
 
 	void Map::Service::init(Vector2i const& gridsize, Vector2f const& cellsize) {
+		Vector2i old_size = grid_size;
 		grid_size = gridsize;
 		cell_size = cellsize;
 
 		//Initialize grid
-		grid.resize(grid_size.y);
-		for (size_t i = 0; i < grid_size.y; ++i) {
-			grid.at(i).resize(grid_size.x);
-		}
+		resizeOccupancy(old_size);
 
-		updateCells();
+		updateGridScale();
 	}
 
 	void Map::Service::setCellBlocked(size_t x, size_t y, bool blocked) {
 		if (x < 0 || x >= grid_size.x || y < 0 || y >= grid_size.y) {
 			throw std::out_of_range("Cell coordinates out of bounds");
 		}
-		grid.at(y).at(x).b_blocked = blocked;
+
+		//Skip cells already in state
+		int cell = static_cast<int>(y) * grid_size.x + static_cast<int>(x);
+		if (isBlockedAt(cell) == blocked) return;
+		occupancy[cell >> 6] ^= uint64_t(1) << (cell & 63);
+		b_flow_valid = false;
+
+		//Rebuild cluster on next hierarchical search
+		if (!clusters.empty()) {
+			dirty_clusters.insert(static_cast<int>((y / PATH_CLUSTER_SIZE) * cluster_count.x + x / PATH_CLUSTER_SIZE));
+		}
+
+		//Grow touching dirty region or start a new one
+		Vector2i index{ static_cast<int>(x), static_cast<int>(y) };
+		for (auto& region : pending_regions) {
+			if (index.x >= region.min.x - 1 && index.x <= region.max.x + 1 && index.y >= region.min.y - 1 && index.y <= region.max.y + 1) {
+				region.min = { Utility::getMin(region.min.x, index.x), Utility::getMin(region.min.y, index.y) };
+				region.max = { Utility::getMax(region.max.x, index.x), Utility::getMax(region.max.y, index.y) };
+				return;
+			}
+		}
+		pending_regions.push_back({ index, index, 0 });
 	}
 
 	bool Map::Service::isCellBlocked(size_t x, size_t y) const {
 		if (x < 0 || x >= grid_size.x || y < 0 || y >= grid_size.y) {
 			throw std::out_of_range("Cell coordinates out of bounds");
 		}
-		return grid.at(y).at(x).b_blocked;
+		return isBlockedAt(static_cast<int>(y) * grid_size.x + static_cast<int>(x));
 	}
 
 	void Map::Service::setGridSize(Vector2i const& size) {
+		Vector2i old_size = grid_size;
 		grid_size = size;
 
 		//Initialize grid
-		grid.resize(grid_size.y);
-		for (size_t i = 0; i < grid_size.y; ++i) {
-			grid.at(i).resize(grid_size.x);
-		}
+		resizeOccupancy(old_size);
 
-		updateCells();
+		updateGridScale();
 	}
 
 	Vector2i Map::Service::getGridSize() const {
@@ -104,7 +132,7 @@ namespace NIKE {
 	void Map::Service::setCellSize(Vector2f const& size) {
 		cell_size = size;
 
-		updateCells();
+		updateGridScale();
 	}
 
 	Vector2f Map::Service::getCellSize() const {
@@ -117,11 +145,15 @@ namespace NIKE {
 
 	void Map::Service::resetGrid()
 	{
+		Vector2i old_size = grid_size;
 		cell_size = { DEFAULT_CELL_SIZE };
 		grid_size = { DEFAULT_GRID_SIZE };
+
+		resizeOccupancy(old_size);
+		updateGridScale();
 	}
 
-	std::optional<std::reference_wrapper<Map::Cell>> Map::Service::getCursorCell() {
+	std::optional<Vector2i> Map::Service::getCursorCell() const {
 
 		Vector2f translated_cursor { cursor_pos.x + (grid_scale.x / 2.0f), -cursor_pos.y + (grid_scale.y / 2.0f) };
 
@@ -133,24 +165,7 @@ namespace NIKE {
 			return std::nullopt;
 		}
 		else {
-			return grid.at(cell_index.y).at(cell_index.x);
-		}
-	}
-
-	std::optional<std::reference_wrapper<Map::Cell>> Map::Service::getCellAtPosition(Vector2f const& position) {
-
-		//Translate position
-		Vector2f translated_pos{ position.x + (grid_scale.x / 2.0f), -position.y + (grid_scale.y / 2.0f) };
-
-		//Get index for cell
-		Vector2i cell_index{ static_cast<int>(translated_pos.x / cell_size.x), static_cast<int>(translated_pos.y / cell_size.y) };
-
-		//Check if index is valid
-		if (cell_index.x < 0 || cell_index.x >= grid_size.x || cell_index.y < 0 || cell_index.y >= grid_size.y) {
-			return std::nullopt;
-		}
-		else {
-			return grid.at(cell_index.y).at(cell_index.x);
+			return cell_index;
 		}
 	}
 
@@ -170,23 +185,34 @@ namespace NIKE {
 		return cell_index;
 	}
 
-	std::vector<std::vector<Map::Cell>>const& Map::Service::getGrid() const {
-		return grid;
+	Vector2f Map::Service::getCellPosition(Vector2i const& index) const {
+		if (index.x < 0 || index.x >= grid_size.x || index.y < 0 || index.y >= grid_size.y) {
+			throw std::out_of_range("Cell coordinates out of bounds");
+		}
+
+		//Cell centre from index ( row 0 is top of grid )
+		return { -(grid_scale.x / 2.0f) + cell_size.x * (static_cast<float>(index.x) + 0.5f), (grid_scale.y / 2.0f) - cell_size.y * (static_cast<float>(index.y) + 0.5f) };
 	}
 
 	void Map::Service::gridUpdate() {
 
 		//Reset cell changed
 		b_cell_changed = false;
+		if (pending_regions.empty()) return;
+
+		//Publish regions changed since last update under new generation
+		b_cell_changed = true;
+		++grid_generation;
+		for (auto& region : pending_regions) {
+			region.generation = grid_generation;
+			changed_regions.push_back(region);
+		}
+		pending_regions.clear();
 
-		//Iterate through grid
-		for (auto& row : grid) {
-			for (auto& cell : row) {
-				if (cell.b_blocked_prev != cell.b_blocked) {
-					cell.b_blocked_prev = cell.b_blocked;
-					b_cell_changed = true;
-				}
-			}
+		//Drop oldest regions ( queries older than trimmed generation are treated as changed )
+		while (changed_regions.size() > GRID_REGION_HISTORY) {
+			trimmed_generation = changed_regions.front().generation;
+			changed_regions.pop_front();
 		}
 	}
 
@@ -194,6 +220,51 @@ namespace NIKE {
 		return b_cell_changed;
 	}
 
+	uint64_t Map::Service::getGridGeneration() const {
+		return grid_generation;
+	}
+
+	bool Map::Service::isRegionChanged(Vector2i const& min, Vector2i const& max, uint64_t since_generation) const {
+
+		//History no longer covers generation
+		if (since_generation < trimmed_generation) return true;
+
+		for (auto const& region : changed_regions) {
+			if (region.generation <= since_generation) continue;
+			if (region.min.x <= max.x && region.max.x >= min.x && region.min.y <= max.y && region.max.y >= min.y) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool Map::Service::isPathAffected(Entity::Type entity) const {
+		auto it = paths.find(entity);
+		if (it == paths.end()) return false;
+
+		//Path is up to date with grid
+		auto const& path = it->second;
+		if (path.generation == grid_generation) return false;
+		if (path.generation < trimmed_generation) return true;
+
+		//Check refined cells
+		for (auto const& cell : path.path) {
+			if (isRegionChanged(cell, cell, path.generation)) return true;
+		}
+
+		//Check spans between unrefined waypoints
+		Vector2i prev = path.path.empty() ? (path.waypoints.empty() ? path.end : path.waypoints.front()) : path.path.back();
+		for (auto const& waypoint : path.waypoints) {
+			Vector2i min{ Utility::getMin(prev.x, waypoint.x), Utility::getMin(prev.y, waypoint.y) };
+			Vector2i max{ Utility::getMax(prev.x, waypoint.x), Utility::getMax(prev.y, waypoint.y) };
+			if (isRegionChanged(min, max, path.generation)) return true;
+			prev = waypoint;
+		}
+
+		return false;
+	}
+
 	nlohmann::json Map::Service::serialize() const {
 		nlohmann::json data;
 
@@ -204,11 +275,11 @@ namespace NIKE {
 
 		//Serialize grid
 		data["Grid"] = nlohmann::json::array();
-		for (const auto& row : grid) {
+		for (int y = 0; y < grid_size.y; ++y) {
 			nlohmann::json row_json = nlohmann::json::array();
-			for (const auto& cell : row) {
+			for (int x = 0; x < grid_size.x; ++x) {
 				nlohmann::json cell_json;
-				cell_json = { {"Blocked", cell.b_blocked}, {"Position", cell.position.toJson()}};
+				cell_json = { {"Blocked", isBlockedAt(y * grid_size.x + x)}, {"Position", getCellPosition({ x, y }).toJson()}};
 				row_json.push_back(cell_json);
 			}
 			data["Grid"].push_back(row_json);
@@ -221,23 +292,24 @@ namespace NIKE {
 		grid_size.fromJson(data.value("Grid_Size", Vector2i::def_json));
 		cell_size.fromJson(data.value("Cell_Size", Vector2i::def_json));
 
-		//Deserialize grid
-		grid.clear();
+		//Deserialize grid ( positions are derived from index )
+		resizeOccupancy({ 0, 0 });
 		if (data.contains("Grid")) {
+			int y = 0;
 			for (const auto& row_json : data["Grid"]) {
-				std::vector<Cell> row;
+				int x = 0;
 				for (const auto& cell_json : row_json) {
-					Cell cell{};
-					// Note 1: Blocked boolean is properly seri and registered. suspect: somewhr might be interferring with the boolean?
-					cell.b_blocked = cell_json.value("Blocked", false);
-					cell.position.fromJson(cell_json.value("Position", Vector2f::def_json));
-					row.push_back(cell);
+					if (x < grid_size.x && y < grid_size.y && cell_json.value("Blocked", false)) {
+						int cell = y * grid_size.x + x;
+						occupancy[cell >> 6] |= uint64_t(1) << (cell & 63);
+					}
+					++x;
 				}
-				grid.push_back(row);
+				++y;
 			}
 		}
 
-		updateCells();
+		updateGridScale();
 	}
 
 	/************************
@@ -341,156 +413,706 @@ namespace NIKE {
 			return {};
 	}*/
 
-	void Map::Service::findPath(Entity::Type entity, const Vector2i& start, const Vector2i& goal, bool b_diagonal) {
+	bool Map::Service::isNodeBefore(int lhs, int rhs) const {
+		auto const& a = path_nodes[lhs];
+		auto const& b = path_nodes[rhs];
+		if (a.f != b.f) return a.f < b.f;
+		if (a.h != b.h) return a.h < b.h;
+		if (a.g != b.g) return a.g < b.g;
+		return lhs < rhs;
+	}
 
-		//Custom comparator
-		struct CostComparator {
-			bool operator()(Cell const* lhs, Cell const* rhs) const {
+	void Map::Service::openSiftUp(size_t heap_pos) {
+		int node = open_heap[heap_pos];
+		while (heap_pos > 0) {
+			size_t parent_pos = (heap_pos - 1) / 2;
+			if (!isNodeBefore(node, open_heap[parent_pos])) break;
 
-				//Comparison For Set !Set will ignore elements that are equal hence comparing memory address at the end
-				if(*lhs < *rhs) return true;
-				if(*lhs > *rhs) return false;
- 				return lhs < rhs;
-			}
-		};
+			//Move parent down
+			open_heap[heap_pos] = open_heap[parent_pos];
+			path_nodes[open_heap[heap_pos]].heap_index = static_cast<int>(heap_pos);
+			heap_pos = parent_pos;
+		}
+		open_heap[heap_pos] = node;
+		path_nodes[node].heap_index = static_cast<int>(heap_pos);
+	}
 
-		//Distance to start
-		auto g_calculator = [](Cell const& cell) -> int {
-			int diagonal{ 14 };
-			int updown{ 10 };
+	void Map::Service::openSiftDown(size_t heap_pos) {
+		int node = open_heap[heap_pos];
+		size_t count = open_heap.size();
+		while (true) {
+			size_t child_pos = heap_pos * 2 + 1;
+			if (child_pos >= count) break;
 
-			if (std::abs(static_cast<int>(cell.parent->index.x - cell.index.x)) && std::abs(static_cast<int>(cell.parent->index.y - cell.index.y))) {
-				return cell.parent->g + diagonal;
+			//Pick better child
+			if (child_pos + 1 < count && isNodeBefore(open_heap[child_pos + 1], open_heap[child_pos])) {
+				++child_pos;
 			}
-			else {
-				return cell.parent->g + updown;
+			if (!isNodeBefore(open_heap[child_pos], node)) break;
+
+			//Move child up
+			open_heap[heap_pos] = open_heap[child_pos];
+			path_nodes[open_heap[heap_pos]].heap_index = static_cast<int>(heap_pos);
+			heap_pos = child_pos;
+		}
+		open_heap[heap_pos] = node;
+		path_nodes[node].heap_index = static_cast<int>(heap_pos);
+	}
+
+	void Map::Service::openPush(int node) {
+		open_heap.push_back(node);
+		openSiftUp(open_heap.size() - 1);
+	}
+
+	int Map::Service::openPop() {
+		int top = open_heap.front();
+		path_nodes[top].heap_index = -1;
+
+		//Move last node to top
+		int last = open_heap.back();
+		open_heap.pop_back();
+		if (!open_heap.empty()) {
+			open_heap.front() = last;
+			openSiftDown(0);
+		}
+
+		return top;
+	}
+
+	void Map::Service::beginSearch(size_t node_count) {
+
+		//Resize nodes when grid changes size
+		if (path_nodes.size() != node_count) {
+			path_nodes.assign(node_count, PathNode());
+			search_stamp = 0;
+		}
+
+		//New search stamp ( nodes from previous searches become stale without reset )
+		if (++search_stamp == 0) {
+			for (auto& node : path_nodes) {
+				node.visited = 0;
 			}
-			};
+			search_stamp = 1;
+		}
+		open_heap.clear();
+	}
 
-		//Distance to goal
-		auto h_calculator = [&, b_diagonal](Vector2i const& index, Vector2i const& end) -> int {
-			int diagonal{ 14 };
-			int updown{ 10 };
+	bool Map::Service::searchPath(Vector2i const& start, Vector2i const& goal, bool b_diagonal, std::vector<Vector2i>& out_path) {
 
-			int x_moves{ std::abs(static_cast<int>(end.x - index.x)) };
-			int y_moves{ std::abs(static_cast<int>(end.y - index.y)) };
+		//Grid dimensions
+		int height = grid_size.y;
+		int width = grid_size.x;
 
-			int diagonal_dist;
-			int updown_dist;
+		//Movement costs
+		constexpr int DIAGONAL_COST = 14;
+		constexpr int UPDOWN_COST = 10;
+
+		//Distance to goal
+		auto h_calculator = [&goal, b_diagonal](int x, int y) -> int {
+			int x_moves{ std::abs(goal.x - x) };
+			int y_moves{ std::abs(goal.y - y) };
 
 			if (b_diagonal) {
-				diagonal_dist = Utility::getMin(x_moves, y_moves) * diagonal;
-				updown_dist = (Utility::getMax(x_moves, y_moves) - Utility::getMin(x_moves, y_moves)) * updown;
+				return Utility::getMin(x_moves, y_moves) * DIAGONAL_COST + (Utility::getMax(x_moves, y_moves) - Utility::getMin(x_moves, y_moves)) * UPDOWN_COST;
 			}
 			else {
-				diagonal_dist = x_moves * updown;
-				updown_dist = y_moves * updown;
+				return (x_moves + y_moves) * UPDOWN_COST;
 			}
-
-			return diagonal_dist + updown_dist;
 			};
 
-		//Open list
-		std::set<Cell*, CostComparator> open_list;
-
-		//Close list
-		std::set<Cell*, CostComparator> closed_list;
-
-		//Calculate h for all cells
-		for (size_t i{ 0 }; i < grid.size(); i++) {
-			for (size_t j{ 0 }; j < grid.at(i).size(); j++) {
-				grid.at(i).at(j).h = h_calculator(Vector2i(static_cast<int>(j), static_cast<int>(i)), goal);
-				grid.at(i).at(j).g = 0;
-				grid.at(i).at(j).f = 0;
-				grid.at(i).at(j).parent = nullptr;
-			}
+		beginSearch(static_cast<size_t>(width) * static_cast<size_t>(height));
+
+		//Initialize start node
+		int start_node = start.y * width + start.x;
+		int goal_node = goal.y * width + goal.x;
+		{
+			auto& node = path_nodes[start_node];
+			node.g = 0;
+			node.h = h_calculator(start.x, start.y);
+			node.f = node.h;
+			node.parent = start_node;
+			node.visited = search_stamp;
+			node.b_closed = false;
+			openPush(start_node);
 		}
 
-		//Initialize start cell
-		Cell* head = &grid.at(start.y).at(start.x);
-		head->parent = head;
-		open_list.insert(head);
+		//Closest expanded node to goal ( fallback when goal is unreachable )
+		int best_node = start_node;
 		bool b_path_found = false;
 
 		//Search for path
-		while (!open_list.empty()) {
+		while (!open_heap.empty()) {
+			int head = openPop();
+			auto& head_node = path_nodes[head];
+			head_node.b_closed = true;
+
+			//Track next best path
+			auto const& best = path_nodes[best_node];
+			if (head_node.h < best.h || (head_node.h == best.h && head_node.g < best.g)) {
+				best_node = head;
+			}
 
 			//Check if goal has been reached
-			if (head->index == goal) {
+			if (head == goal_node) {
 				b_path_found = true;
 				break;
 			}
 
-			//Add Neighbours Of Nodes Into Open Container
-			for (int i = head->index.y - 1; i <= head->index.y + 1; i++) {
-				for (int j = head->index.x - 1; j <= head->index.x + 1; j++) {
-
-					//Skip diagonal search
-					if (!b_diagonal && ((i == head->index.y - 1 && j == head->index.x - 1) || (i == head->index.y - 1 && j == head->index.x + 1)
-						|| (i == head->index.y + 1 && j == head->index.x - 1) || (i == head->index.y + 1 && j == head->index.x + 1))) continue;
-
-					//Skip boundaries, blocked cells and node itself
-					if ((i == head->index.y && j == head->index.x) ||
-						i >= grid.size() ||
-						j >= grid.at(0).size() ||
-						i < 0 || j < 0 ||
-						grid.at(i).at(j).b_blocked) continue;
-
-					//Check For Duplicates
-					if (open_list.find(&grid.at(i).at(j)) != open_list.end() || closed_list.find(&grid.at(i).at(j)) != closed_list.end()) {
-						if (g_calculator(grid.at(i).at(j)) < grid.at(i).at(j).g) {
-							open_list.erase(open_list.find(&grid.at(i).at(j)));
-							grid.at(i).at(j).parent = head;
-							grid.at(i).at(j).g = g_calculator(grid.at(i).at(j));
-							open_list.insert(&grid.at(i).at(j));
-						}
+			int head_x = head % width;
+			int head_y = head / width;
+
+			//Expand neighbours
+			for (int i = head_y - 1; i <= head_y + 1; i++) {
+				for (int j = head_x - 1; j <= head_x + 1; j++) {
+					bool b_diagonal_step = (i != head_y) && (j != head_x);
+
+					//Skip diagonal search, boundaries, blocked cells and node itself
+					if ((!b_diagonal && b_diagonal_step) ||
+						(i == head_y && j == head_x) ||
+						i < 0 || j < 0 || i >= height || j >= width ||
+						isBlockedAt(i * width + j)) continue;
+
+					int neighbour = i * width + j;
+					auto& node = path_nodes[neighbour];
+					int g = head_node.g + (b_diagonal_step ? DIAGONAL_COST : UPDOWN_COST);
+
+					//First visit this search
+					if (node.visited != search_stamp) {
+						node.g = g;
+						node.h = h_calculator(j, i);
+						node.f = g + node.h;
+						node.parent = head;
+						node.visited = search_stamp;
+						node.b_closed = false;
+						openPush(neighbour);
+					}
+					//Cheaper route to open node
+					else if (!node.b_closed && g < node.g) {
+						node.g = g;
+						node.f = g + node.h;
+						node.parent = head;
+						openSiftUp(node.heap_index);
+					}
+				}
+			}
+		}
+
+		//Trace back path
+		size_t first = out_path.size();
+		for (int node = b_path_found ? goal_node : best_node; node != start_node; node = path_nodes[node].parent) {
+			out_path.push_back(Vector2i(node % width, node / width));
+		}
+		std::reverse(out_path.begin() + first, out_path.end());
+
+		return b_path_found;
+	}
+
+	void Map::Service::findPath(Entity::Type entity, const Vector2i& start, const Vector2i& goal, bool b_diagonal) {
+
+		//Grid dimensions
+		int height = grid_size.y;
+		int width = grid_size.x;
+		if (start.x < 0 || start.x >= width || start.y < 0 || start.y >= height ||
+			goal.x < 0 || goal.x >= width || goal.y < 0 || goal.y >= height) {
+			throw std::out_of_range("Path coordinates out of bounds");
+		}
+
+		auto& entity_path = paths[entity];
+		entity_path.path.clear();
+		entity_path.waypoints.clear();
+		entity_path.end = start;
+
+		//Long range paths search cluster entrances first & refine only the next cluster
+		bool b_cluster_path = false;
+		int start_cluster_x = start.x / PATH_CLUSTER_SIZE;
+		int start_cluster_y = start.y / PATH_CLUSTER_SIZE;
+		if (!b_diagonal &&
+			(std::abs(goal.x / PATH_CLUSTER_SIZE - start_cluster_x) > 1 || std::abs(goal.y / PATH_CLUSTER_SIZE - start_cluster_y) > 1)) {
+			updateClusters();
+
+			std::vector<int> nodes;
+			if (searchClusterPath(start, goal, nodes) && !nodes.empty()) {
+				for (int node : nodes) {
+					entity_path.waypoints.push_back(Vector2i(node % width, node / width));
+				}
+
+				//Path end is last abstract node, cells beyond next cluster are refined lazily
+				entity_path.end = entity_path.waypoints.back();
+				refineNextCluster(entity_path, start);
+				b_cluster_path = true;
+			}
+		}
+
+		//Short range or no cluster route ( flat search keeps its best effort partial path )
+		if (!b_cluster_path) {
+			searchPath(start, goal, b_diagonal, entity_path.path);
+			if (!entity_path.path.empty()) {
+				entity_path.end = entity_path.path.back();
+			}
+		}
+
+		//Update entity path
+		entity_path.b_finished = false;
+		entity_path.goal = goal;
+		entity_path.generation = grid_generation;
+	}
+
+	void Map::Service::refineNextCluster(Path& path, Vector2i const& from) {
+
+		//Refine waypoints up to first cell outside of current cluster
+		int from_cluster = getClusterIndex(from.y * grid_size.x + from.x);
+		Vector2i current = from;
+		size_t refined = 0;
+		while (refined < path.waypoints.size()) {
+			Vector2i next = path.waypoints[refined++];
+			int next_cell = next.y * grid_size.x + next.x;
+
+			//Entrance transitions are single steps
+			if (std::abs(next.x - current.x) + std::abs(next.y - current.y) <= 1) {
+				if (next != current) {
+					path.path.push_back(next);
+				}
+			}
+			else {
+				searchPath(current, next, false, path.path);
+			}
+
+			current = next;
+			if (getClusterIndex(next_cell) != from_cluster) break;
+		}
+
+		path.waypoints.erase(path.waypoints.begin(), path.waypoints.begin() + refined);
+	}
+
+	void Map::Service::refinePath(Entity::Type entity) {
+		auto it = paths.find(entity);
+		if (it == paths.end() || it->second.waypoints.empty()) return;
+
+		//Continue from last refined cell
+		auto& path = it->second;
+		Vector2i from = path.path.empty() ? path.waypoints.front() : path.path.back();
+		refineNextCluster(path, from);
+	}
+
+	void Map::Service::requestPath(Entity::Type entity, Vector2i const& start, Vector2i const& goal, bool b_diagonal, PathCallback callback) {
+
+		//Newer request replaces pending one but keeps its place in queue
+		auto it = path_requests.find(entity);
+		if (it == path_requests.end()) {
+			it = path_requests.emplace(entity, PathRequest()).first;
+			path_request_order.push_back(entity);
+		}
+
+		auto& request = it->second;
+		request.start = start;
+		request.goal = goal;
+		request.b_diagonal = b_diagonal;
+		request.callback = std::move(callback);
+	}
+
+	bool Map::Service::isPathPending(Entity::Type entity) const {
+		return path_requests.find(entity) != path_requests.end();
+	}
+
+	void Map::Service::updatePathRequests() {
+
+		//Grid dimensions
+		int height = grid_size.y;
+		int width = grid_size.x;
+
+		auto frame_start = std::chrono::steady_clock::now();
+		while (!path_request_order.empty()) {
+			Entity::Type entity = path_request_order.front();
+			path_request_order.pop_front();
+
+			//Skip requests removed since queued
+			auto it = path_requests.find(entity);
+			if (it == path_requests.end()) continue;
+			PathRequest request = std::move(it->second);
+			path_requests.erase(it);
+
+			//Skip requests outside of grid ( grid replaced since queued )
+			if (request.start.x < 0 || request.start.x >= width || request.start.y < 0 || request.start.y >= height ||
+				request.goal.x < 0 || request.goal.x >= width || request.goal.y < 0 || request.goal.y >= height) continue;
+
+			//Publish path
+			findPath(entity, request.start, request.goal, request.b_diagonal);
+			if (request.callback) {
+				request.callback(entity, paths.at(entity));
+			}
+
+			//Remaining requests wait for next frame once budget is used ( at least one is solved per frame )
+			auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - frame_start);
+			if (elapsed.count() >= path_budget) break;
+		}
+	}
+
+	void Map::Service::setPathBudget(int microseconds) {
+		path_budget = microseconds;
+	}
+
+	int Map::Service::getPathBudget() const {
+		return path_budget;
+	}
+
+	int Map::Service::getClusterIndex(int cell) const {
+		int width = grid_size.x;
+		return (cell / width / PATH_CLUSTER_SIZE) * cluster_count.x + (cell % width) / PATH_CLUSTER_SIZE;
+	}
+
+	void Map::Service::buildClusters() {
+
+		//Grid dimensions
+		int height = grid_size.y;
+		int width = grid_size.x;
+
+		cluster_count = { (width + PATH_CLUSTER_SIZE - 1) / PATH_CLUSTER_SIZE, (height + PATH_CLUSTER_SIZE - 1) / PATH_CLUSTER_SIZE };
+		clusters.assign(static_cast<size_t>(cluster_count.x) * static_cast<size_t>(cluster_count.y), PathCluster());
+		dirty_clusters.clear();
+
+		//Cluster bounds ( edge clusters may be smaller )
+		for (int cy = 0; cy < cluster_count.y; ++cy) {
+			for (int cx = 0; cx < cluster_count.x; ++cx) {
+				auto& cluster = clusters[cy * cluster_count.x + cx];
+				cluster.origin = { cx * PATH_CLUSTER_SIZE, cy * PATH_CLUSTER_SIZE };
+				cluster.size = { Utility::getMin(PATH_CLUSTER_SIZE, width - cluster.origin.x), Utility::getMin(PATH_CLUSTER_SIZE, height - cluster.origin.y) };
+			}
+		}
+
+		//Entrances before nodes, nodes read entrances of neighbours
+		for (int i = 0; i < static_cast<int>(clusters.size()); ++i) {
+			buildClusterBorders(i);
+		}
+		for (int i = 0; i < static_cast<int>(clusters.size()); ++i) {
+			buildClusterNodes(i);
+		}
+	}
+
+	void Map::Service::updateClusters() {
+
+		//Grid dimensions
+		int height = grid_size.y;
+		int width = grid_size.x;
+
+		//Full rebuild when grid was replaced or resized
+		Vector2i expected_count{ (width + PATH_CLUSTER_SIZE - 1) / PATH_CLUSTER_SIZE, (height + PATH_CLUSTER_SIZE - 1) / PATH_CLUSTER_SIZE };
+		if (clusters.empty() || cluster_count != expected_count ||
+			clusters.back().origin.x + clusters.back().size.x != width || clusters.back().origin.y + clusters.back().size.y != height) {
+			buildClusters();
+			return;
+		}
+
+		if (dirty_clusters.empty()) return;
+
+		//Borders touching dirty clusters ( left & upper neighbours own the shared border )
+		std::unordered_set<int> border_clusters;
+		std::unordered_set<int> node_clusters;
+		for (int index : dirty_clusters) {
+			int cx = index % cluster_count.x;
+			int cy = index / cluster_count.x;
+			border_clusters.insert(index);
+			node_clusters.insert(index);
+			if (cx > 0) {
+				border_clusters.insert(index - 1);
+				node_clusters.insert(index - 1);
+			}
+			if (cy > 0) {
+				border_clusters.insert(index - cluster_count.x);
+				node_clusters.insert(index - cluster_count.x);
+			}
+			if (cx + 1 < cluster_count.x) node_clusters.insert(index + 1);
+			if (cy + 1 < cluster_count.y) node_clusters.insert(index + cluster_count.x);
+		}
+		dirty_clusters.clear();
+
+		for (int index : border_clusters) {
+			buildClusterBorders(index);
+		}
+		for (int index : node_clusters) {
+			buildClusterNodes(index);
+		}
+	}
+
+	void Map::Service::buildClusterBorders(int cluster_index) {
+		int width = grid_size.x;
+		auto& cluster = clusters[cluster_index];
+		cluster.right_transitions.clear();
+		cluster.down_transitions.clear();
+
+		//Scan border for runs of cells open on both sides
+		auto scan_border = [this](std::vector<std::pair<int, int>>& transitions, int first, int stride, int offset, int length) {
+
+			int run_start = -1;
+			for (int i = 0; i <= length; ++i) {
+				int cell = first + i * stride;
+				bool b_open = i < length && !isBlockedAt(cell) && !isBlockedAt(cell + offset);
+				if (b_open && run_start < 0) {
+					run_start = i;
+				}
+				else if (!b_open && run_start >= 0) {
+
+					//Short runs get a single entrance in the middle, long runs one at each end
+					int run_length = i - run_start;
+					if (run_length < PATH_ENTRANCE_SPLIT) {
+						int middle = first + (run_start + run_length / 2) * stride;
+						transitions.emplace_back(middle, middle + offset);
 					}
 					else {
-						grid.at(i).at(j).parent = head;
-						grid.at(i).at(j).g = g_calculator(grid.at(i).at(j));
-						open_list.insert(&grid.at(i).at(j));
+						int run_first = first + run_start * stride;
+						int run_last = first + (i - 1) * stride;
+						transitions.emplace_back(run_first, run_first + offset);
+						transitions.emplace_back(run_last, run_last + offset);
 					}
+					run_start = -1;
 				}
 			}
+			};
+
+		int cx = cluster_index % cluster_count.x;
+		int cy = cluster_index / cluster_count.x;
 
-			//Remove head from open list & add to closed list
-			closed_list.insert(head);
-			open_list.erase(open_list.find(head));
-			if (!open_list.empty()) {
-				head = *open_list.begin();
+		//Right border
+		if (cx + 1 < cluster_count.x) {
+			int first = cluster.origin.y * width + cluster.origin.x + cluster.size.x - 1;
+			scan_border(cluster.right_transitions, first, width, 1, cluster.size.y);
+		}
+
+		//Lower border
+		if (cy + 1 < cluster_count.y) {
+			int first = (cluster.origin.y + cluster.size.y - 1) * width + cluster.origin.x;
+			scan_border(cluster.down_transitions, first, 1, width, cluster.size.x);
+		}
+	}
+
+	void Map::Service::buildClusterNodes(int cluster_index) {
+		int width = grid_size.x;
+		auto& cluster = clusters[cluster_index];
+		int cx = cluster_index % cluster_count.x;
+		int cy = cluster_index / cluster_count.x;
+
+		//Gather entrance cells from all four borders
+		cluster.nodes.clear();
+		auto add_node = [&cluster](int cell) {
+			if (std::find(cluster.nodes.begin(), cluster.nodes.end(), cell) == cluster.nodes.end()) {
+				cluster.nodes.push_back(cell);
 			}
+			};
+		for (auto const& transition : cluster.right_transitions) add_node(transition.first);
+		for (auto const& transition : cluster.down_transitions) add_node(transition.first);
+		if (cx > 0) {
+			for (auto const& transition : clusters[cluster_index - 1].right_transitions) add_node(transition.second);
+		}
+		if (cy > 0) {
+			for (auto const& transition : clusters[cluster_index - cluster_count.x].down_transitions) add_node(transition.second);
 		}
 
-		//Find next best path
-		if (!b_path_found) {
-			if (!closed_list.empty()) {
-				head = *closed_list.begin();
+		//Intra cluster distances between entrances
+		size_t node_count = cluster.nodes.size();
+		cluster.distances.assign(node_count * node_count, -1);
+		for (size_t i = 0; i < node_count; ++i) {
+			clusterCosts(cluster_index, cluster.nodes[i], cluster_costs);
+			for (size_t j = 0; j < node_count; ++j) {
+				int cell = cluster.nodes[j];
+				int local = (cell / width - cluster.origin.y) * cluster.size.x + (cell % width - cluster.origin.x);
+				cluster.distances[i * node_count + j] = cluster_costs[local];
 			}
 		}
+	}
 
-		//Trace back path
-		std::deque<Cell> path;
-		while (head->index != start) {
-			path.push_front(grid.at(head->index.y).at(head->index.x));
-			head = grid.at(head->index.y).at(head->index.x).parent;
+	void Map::Service::clusterCosts(int cluster_index, int source, std::vector<int>& costs) {
+
+		//Movement costs
+		constexpr int UPDOWN_COST = 10;
+
+		int width = grid_size.x;
+		auto const& cluster = clusters[cluster_index];
+		costs.assign(static_cast<size_t>(cluster.size.x) * static_cast<size_t>(cluster.size.y), -1);
+
+		//Breadth first search bounded by cluster
+		int source_local = (source / width - cluster.origin.y) * cluster.size.x + (source % width - cluster.origin.x);
+		costs[source_local] = 0;
+		cluster_queue.clear();
+		cluster_queue.push_back(source_local);
+		for (size_t head = 0; head < cluster_queue.size(); ++head) {
+			int local = cluster_queue[head];
+			int x = local % cluster.size.x;
+			int y = local / cluster.size.x;
+
+			const int direction_x[] = { -1, 0, 1, 0 };
+			const int direction_y[] = { 0, 1, 0, -1 };
+			for (int i = 0; i < 4; ++i) {
+				int new_x = x + direction_x[i];
+				int new_y = y + direction_y[i];
+				if (new_x < 0 || new_x >= cluster.size.x || new_y < 0 || new_y >= cluster.size.y ||
+					isBlockedAt((cluster.origin.y + new_y) * width + cluster.origin.x + new_x)) continue;
+
+				int neighbour = new_y * cluster.size.x + new_x;
+				if (costs[neighbour] != -1) continue;
+
+				costs[neighbour] = costs[local] + UPDOWN_COST;
+				cluster_queue.push_back(neighbour);
+			}
 		}
+	}
 
-		//Update entity path
-		paths[entity].path = path;
-		paths[entity].b_finished = false;
-		paths[entity].goal = grid.at(goal.y).at(goal.x);
-		if (!paths[entity].path.empty()) {
-			paths[entity].end = paths[entity].path.back();
+	bool Map::Service::searchClusterPath(Vector2i const& start, Vector2i const& goal, std::vector<int>& out_nodes) {
+
+		//Movement costs
+		constexpr int UPDOWN_COST = 10;
+
+		//Grid dimensions
+		int height = grid_size.y;
+		int width = grid_size.x;
+
+		int start_node = start.y * width + start.x;
+		int goal_node = goal.y * width + goal.x;
+		int start_cluster = getClusterIndex(start_node);
+		int goal_cluster = getClusterIndex(goal_node);
+
+		//Connect start & goal to entrances of their clusters ( blocked goal stays unreachable )
+		clusterCosts(start_cluster, start_node, start_costs);
+		if (isBlockedAt(goal_node)) {
+			goal_costs.assign(static_cast<size_t>(clusters[goal_cluster].size.x) * static_cast<size_t>(clusters[goal_cluster].size.y), -1);
+		}
+		else {
+			clusterCosts(goal_cluster, goal_node, goal_costs);
 		}
+
+		auto local_index = [this, width](int cluster_index, int cell) {
+			auto const& cluster = clusters[cluster_index];
+			return (cell / width - cluster.origin.y) * cluster.size.x + (cell % width - cluster.origin.x);
+			};
+
+		auto h_calculator = [&goal, width](int cell) -> int {
+			return (std::abs(goal.x - cell % width) + std::abs(goal.y - cell / width)) * UPDOWN_COST;
+			};
+
+		beginSearch(static_cast<size_t>(width) * static_cast<size_t>(height));
+
+		//Open or improve abstract node
+		auto relax = [this, &h_calculator](int head, int neighbour, int g) {
+			auto& node = path_nodes[neighbour];
+			if (node.visited != search_stamp) {
+				node.g = g;
+				node.h = h_calculator(neighbour);
+				node.f = g + node.h;
+				node.parent = head;
+				node.visited = search_stamp;
+				node.b_closed = false;
+				openPush(neighbour);
+			}
+			else if (!node.b_closed && g < node.g) {
+				node.g = g;
+				node.f = g + node.h;
+				node.parent = head;
+				openSiftUp(node.heap_index);
+			}
+			};
+
+		//Initialize start node
+		{
+			auto& node = path_nodes[start_node];
+			node.g = 0;
+			node.h = h_calculator(start_node);
+			node.f = node.h;
+			node.parent = start_node;
+			node.visited = search_stamp;
+			node.b_closed = false;
+			openPush(start_node);
+		}
+
+		//Closest expanded node to goal ( fallback when goal is unreachable )
+		int best_node = start_node;
+		bool b_path_found = false;
+
+		//Search over entrances
+		while (!open_heap.empty()) {
+			int head = openPop();
+			path_nodes[head].b_closed = true;
+			int head_g = path_nodes[head].g;
+
+			//Track next best path
+			auto const& best = path_nodes[best_node];
+			if (path_nodes[head].h < best.h || (path_nodes[head].h == best.h && head_g < best.g)) {
+				best_node = head;
+			}
+
+			//Check if goal has been reached
+			if (head == goal_node) {
+				b_path_found = true;
+				break;
+			}
+
+			int head_cluster = getClusterIndex(head);
+			auto const& cluster = clusters[head_cluster];
+
+			//Start connects to every entrance it can reach in its cluster
+			if (head == start_node) {
+				for (int entrance : cluster.nodes) {
+					int cost = start_costs[local_index(head_cluster, entrance)];
+					if (cost > 0) relax(head, entrance, cost);
+				}
+			}
+
+			//Entrance node edges
+			auto node_it = std::find(cluster.nodes.begin(), cluster.nodes.end(), head);
+			if (node_it == cluster.nodes.end()) continue;
+			size_t node_index = static_cast<size_t>(node_it - cluster.nodes.begin());
+			size_t node_count = cluster.nodes.size();
+
+			//Other entrances within cluster
+			for (size_t i = 0; i < node_count; ++i) {
+				int cost = cluster.distances[node_index * node_count + i];
+				if (cost > 0) relax(head, cluster.nodes[i], head_g + cost);
+			}
+
+			//Goal within cluster
+			if (head_cluster == goal_cluster) {
+				int cost = goal_costs[local_index(goal_cluster, head)];
+				if (cost >= 0) relax(head, goal_node, head_g + cost);
+			}
+
+			//Transitions into neighbouring clusters
+			int cx = head_cluster % cluster_count.x;
+			int cy = head_cluster / cluster_count.x;
+			for (auto const& transition : cluster.right_transitions) {
+				if (transition.first == head) relax(head, transition.second, head_g + UPDOWN_COST);
+			}
+			for (auto const& transition : cluster.down_transitions) {
+				if (transition.first == head) relax(head, transition.second, head_g + UPDOWN_COST);
+			}
+			if (cx > 0) {
+				for (auto const& transition : clusters[head_cluster - 1].right_transitions) {
+					if (transition.second == head) relax(head, transition.first, head_g + UPDOWN_COST);
+				}
+			}
+			if (cy > 0) {
+				for (auto const& transition : clusters[head_cluster - cluster_count.x].down_transitions) {
+					if (transition.second == head) relax(head, transition.first, head_g + UPDOWN_COST);
+				}
+			}
+		}
+
+		//Trace back abstract path
+		size_t first = out_nodes.size();
+		for (int node = b_path_found ? goal_node : best_node; node != start_node; node = path_nodes[node].parent) {
+			out_nodes.push_back(node);
+		}
+		std::reverse(out_nodes.begin() + first, out_nodes.end());
+
+		return b_path_found;
 	}
 
-	Map::Path Map::Service::getPath(Entity::Type entity) {
-		if (paths.find(entity) != paths.end()) {
-			return paths.at(entity);
+	Map::Path const& Map::Service::getPath(Entity::Type entity) const {
+		static const Path empty_path;
+
+		auto it = paths.find(entity);
+		if (it != paths.end()) {
+			return it->second;
 		}
 
 		// If not path found, return empty path obj
-		return Path();
+		return empty_path;
 	}
 
 	bool Map::Service::checkPath(Entity::Type entity) const {
@@ -498,12 +1120,152 @@ namespace NIKE {
 		return paths.find(entity) != paths.end();
 	}
 
-	bool Map::Cell::operator<(Map::Cell const& other) const {
-		return (f != other.f) ? (f < other.f) : (h != other.h) ? h < other.h : g < other.g;
+	bool Map::Service::hasLineOfSight(Vector2i const& from, Vector2i const& to) const {
+		if (from.x < 0 || from.x >= grid_size.x || from.y < 0 || from.y >= grid_size.y ||
+			to.x < 0 || to.x >= grid_size.x || to.y < 0 || to.y >= grid_size.y) {
+			throw std::out_of_range("Line of sight coordinates out of bounds");
+		}
+
+		//Walk every cell the line passes through
+		int dx = std::abs(to.x - from.x);
+		int dy = std::abs(to.y - from.y);
+		int step_x = to.x > from.x ? 1 : -1;
+		int step_y = to.y > from.y ? 1 : -1;
+		int error = dx - dy;
+		int x = from.x;
+		int y = from.y;
+		for (int steps = dx + dy; steps > 0; --steps) {
+			if (error > 0) {
+				x += step_x;
+				error -= 2 * dy;
+			}
+			else if (error < 0) {
+				y += step_y;
+				error += 2 * dx;
+			}
+			else {
+
+				//Line passes exactly through a corner, both side cells must be open
+				if (isBlockedAt(y * grid_size.x + x + step_x) || isBlockedAt((y + step_y) * grid_size.x + x)) return false;
+				x += step_x;
+				y += step_y;
+				error += 2 * dx - 2 * dy;
+				--steps;
+			}
+
+			if (isBlockedAt(y * grid_size.x + x)) return false;
+		}
+
+		return true;
+	}
+
+	std::vector<Vector2i> Map::Service::smoothPath(Vector2i const& start, std::vector<Vector2i> const& path) const {
+		std::vector<Vector2i> smoothed;
+
+		//Keep a cell only when the cell after it can no longer be seen from last kept cell
+		Vector2i anchor = start;
+		for (size_t i = 0; i < path.size(); ++i) {
+			if (i + 1 < path.size() && hasLineOfSight(anchor, path[i + 1])) continue;
+
+			smoothed.push_back(path[i]);
+			anchor = path[i];
+		}
+
+		return smoothed;
+	}
+
+	void Map::Service::updateFlowField(Vector2i const& goal, bool b_diagonal) {
+
+		//Grid dimensions
+		int height = grid_size.y;
+		int width = grid_size.x;
+		if (goal.x < 0 || goal.x >= width || goal.y < 0 || goal.y >= height) {
+			throw std::out_of_range("Flow field goal out of bounds");
+		}
+
+		//Skip rebuild when field is still valid
+		size_t cell_count = static_cast<size_t>(width) * static_cast<size_t>(height);
+		if (b_flow_valid && flow_goal == goal && b_flow_diagonal == b_diagonal && flow_costs.size() == cell_count) {
+			return;
+		}
+
+		flow_goal = goal;
+		b_flow_diagonal = b_diagonal;
+		b_flow_valid = true;
+
+		//Movement costs
+		constexpr int DIAGONAL_COST = 14;
+		constexpr int UPDOWN_COST = 10;
+
+		//Reset field
+		flow_costs.assign(cell_count, -1);
+		flow_next.assign(cell_count, -1);
+		flow_frontier.clear();
+
+		//Pack cost & index so heap orders by cost
+		auto pack = [](int cost, int index) -> uint64_t {
+			return (static_cast<uint64_t>(cost) << 32) | static_cast<uint32_t>(index);
+			};
+
+		//Integrate outwards from goal ( Dijkstra )
+		int goal_index = goal.y * width + goal.x;
+		flow_costs[goal_index] = 0;
+		flow_frontier.push_back(pack(0, goal_index));
+		while (!flow_frontier.empty()) {
+			std::pop_heap(flow_frontier.begin(), flow_frontier.end(), std::greater<uint64_t>());
+			uint64_t top = flow_frontier.back();
+			flow_frontier.pop_back();
+
+			int cost = static_cast<int>(top >> 32);
+			int index = static_cast<int>(top & 0xFFFFFFFF);
+
+			//Skip stale entries
+			if (cost != flow_costs[index]) continue;
+
+			int x = index % width;
+			int y = index / width;
+			for (int i = y - 1; i <= y + 1; i++) {
+				for (int j = x - 1; j <= x + 1; j++) {
+					bool b_diagonal_step = (i != y) && (j != x);
+
+					//Skip diagonal search, boundaries, blocked cells and node itself
+					if ((!b_diagonal && b_diagonal_step) ||
+						(i == y && j == x) ||
+						i < 0 || j < 0 || i >= height || j >= width ||
+						isBlockedAt(i * width + j)) continue;
+
+					int neighbour = i * width + j;
+					int new_cost = cost + (b_diagonal_step ? DIAGONAL_COST : UPDOWN_COST);
+					if (flow_costs[neighbour] != -1 && flow_costs[neighbour] <= new_cost) continue;
+
+					//Neighbour steps through this cell to reach goal
+					flow_costs[neighbour] = new_cost;
+					flow_next[neighbour] = index;
+					flow_frontier.push_back(pack(new_cost, neighbour));
+					std::push_heap(flow_frontier.begin(), flow_frontier.end(), std::greater<uint64_t>());
+				}
+			}
+		}
+	}
+
+	std::optional<Vector2i> Map::Service::getFlowStep(Vector2i const& from) const {
+		int height = grid_size.y;
+		int width = grid_size.x;
+		if (from.x < 0 || from.x >= width || from.y < 0 || from.y >= height) return std::nullopt;
+
+		size_t index = static_cast<size_t>(from.y) * width + from.x;
+		if (index >= flow_next.size() || flow_next[index] < 0) return std::nullopt;
+
+		return Vector2i(flow_next[index] % width, flow_next[index] / width);
 	}
 
-	bool Map::Cell::operator>(Map::Cell const& other) const {
-		return (f != other.f) ? (f > other.f) : (h != other.h) ? h > other.h : g > other.g;
+	int Map::Service::getFlowCost(Vector2i const& from) const {
+		int height = grid_size.y;
+		int width = grid_size.x;
+		if (from.x < 0 || from.x >= width || from.y < 0 || from.y >= height) return -1;
+
+		size_t index = static_cast<size_t>(from.y) * width + from.x;
+		return index < flow_costs.size() ? flow_costs[index] : -1;
 	}
 }
 
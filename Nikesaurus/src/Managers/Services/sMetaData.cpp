@@ -78,56 +78,90 @@ namespace NIKE {
 
 	void MetaData::Service::onEvent(std::shared_ptr<Coordinator::EntitiesChanged> event) {
 
-		//Get entities
-		ecs_entities = event->entities;
-
 		//Remove entities that are no longer in the ECS
-		for (auto it = entities.begin(); it != entities.end();) {
-			if (ecs_entities.find(it->first) == ecs_entities.end()) {
-				//Remove entity from layer
-				NIKE_SCENES_SERVICE->getLayer(it->second.layer_id)->removeEntity(it->first);
+		for (auto entity : event->removed) {
+			auto it = entities.find(entity);
+			if (it == entities.end())
+				continue;
 
-				//Erase entity
-				it = entities.erase(it);
-			}
-			else {
-				++it;
-			}
+			//Remove entity from indices
+			unindexEntity(entity);
+
+			//Remove entity from layer
+			NIKE_SCENES_SERVICE->getLayer(it->second.layer_id)->removeEntity(it->first);
+
+			//Erase entity
+			entities.erase(it);
 		}
 
-		//Update entities data
-		updateData();
+		//Add entities created in the ECS
+		for (auto entity : event->added) {
+			registerEntity(entity);
+		}
 	}
 
-	void MetaData::Service::updateData() {
+	void MetaData::Service::registerEntity(Entity::Type entity) {
 
-		//Clear entity names & repopulate them with updated names
-		entity_names.clear();
+		//Update entities ref
+		auto it = entities.find(entity);
+		if (it == entities.end()) {
 
-		//Add new entities from the ECS that are not yet in the editor
-		for (auto& entity : ecs_entities) {
+			//Create identifier for entity
+			setDefaultName(entity);
 
-			//Update entities ref
-			if (entities.find(entity) == entities.end()) {
+			//Set a proper layer ID
+			setEntityLayerID(entity, 0);
 
-				//Create identifier for entity
-				char entity_name[32];
-				snprintf(entity_name, sizeof(entity_name), (def_name + "%04d").data(), entity);
-				entities[entity].name = entity_name;
+			//Populate entity name
+			indexEntity(entity);
+		}
+		else if (it->second.name.find(def_name) != std::string::npos) {
 
-				//Set a proper layer ID
-				setEntityLayerID(entity, 0);
+			//Reset default names that no longer match entity ( only reindex when changed )
+			std::string prev_name = it->second.name;
+			setDefaultName(entity);
+			if (prev_name != it->second.name) {
+				auto name_it = entity_names.find(prev_name);
+				if (name_it != entity_names.end() && name_it->second == entity) {
+					entity_names.erase(name_it);
+				}
+				entity_names[it->second.name] = entity;
 			}
-			else if (entities.at(entity).name.find(def_name) != std::string::npos) {
+		}
+	}
 
-				//Create identifier for entity
-				char entity_name[32];
-				snprintf(entity_name, sizeof(entity_name), (def_name + "%04d").data(), entity);
-				entities[entity].name = entity_name;
-			}
+	void MetaData::Service::setDefaultName(Entity::Type entity) {
 
-			//Populate entity name
-			entity_names[entities[entity].name] = entity;
+		//Create identifier for entity
+		char entity_name[32];
+		snprintf(entity_name, sizeof(entity_name), (def_name + "%04d").data(), entity);
+		entities[entity].name = entity_name;
+	}
+
+	void MetaData::Service::indexEntity(Entity::Type entity) {
+		auto const& data = entities.at(entity);
+
+		entity_names[data.name] = entity;
+		for (auto const& tag : data.tags) {
+			tag_entities[Utility::internString(tag)].insert(entity);
+		}
+	}
+
+	void MetaData::Service::unindexEntity(Entity::Type entity) {
+		auto const& data = entities.at(entity);
+
+		//Only erase name when it still maps to this entity
+		auto name_it = entity_names.find(data.name);
+		if (name_it != entity_names.end() && name_it->second == entity) {
+			entity_names.erase(name_it);
+		}
+
+		//Tag sets are kept when empty so references handed out stay valid
+		for (auto const& tag : data.tags) {
+			auto tag_it = tag_entities.find(Utility::hashString(tag));
+			if (tag_it != tag_entities.end()) {
+				tag_it->second.erase(entity);
+			}
 		}
 	}
 
@@ -144,6 +178,9 @@ namespace NIKE {
 
 		//Empty destroy entities queue
 		if (!entities_to_destroy.empty()) {
+
+			//Batch destruction into a single EntitiesChanged dispatch
+			auto batch = NIKE_ECS_MANAGER->batchEntityChanges();
 			for (auto entity : entities_to_destroy) {
 				if (NIKE_ECS_MANAGER->checkEntity(entity)) {
 
@@ -177,6 +214,7 @@ namespace NIKE {
 	}
 
 	void MetaData::Service::registerTag(std::string const& tag) {
+		Utility::internString(tag);
 		entity_tags.insert(tag);
 	}
 
@@ -206,10 +244,11 @@ namespace NIKE {
 		}
 
 		//Set name
+		unindexEntity(entity);
 		entities.at(entity).name = name;
 
 		//Populate entity name
-		entity_names[entities[entity].name] = entity;
+		indexEntity(entity);
 	}
 
 	std::string MetaData::Service::getEntityName(Entity::Type entity) const {
@@ -223,20 +262,12 @@ namespace NIKE {
 	}
 
 	std::optional<Entity::Type> MetaData::Service::getEntityByName(std::string const& name) const {
-		if (entity_names.find(name) == entity_names.end()) {
-			if (name.find(def_name) != std::string::npos) {
-				for (auto const& data : entities) {
-					if (data.second.name == name) return data.first;
-				}
-
-				return std::nullopt;
-			}
-			else {
-				return std::nullopt;
-			}
+		auto it = entity_names.find(name);
+		if (it == entity_names.end()) {
+			return std::nullopt;
 		}
 
-		return entity_names.at(name);
+		return it->second;
 	}
 
 	void MetaData::Service::setEntityPrefabID(Entity::Type entity, std::string const& prefab_id) {
@@ -257,7 +288,7 @@ namespace NIKE {
 		entities.at(entity).prefab_id = prefab_id;
 
 		//Check if prefab id is valid
-		if (!entities.at(entity).prefab_id.empty() && entities.at(entity).prefab_id.find(".prefab") != std::string::npos) {
+		if (!entities.at(entity).prefab_id.empty() && entities.at(entity).prefab_id.getString().find(".prefab") != std::string::npos) {
 			//Load entity with prefab
 			NIKE_SERIALIZE_SERVICE->loadEntityFromPrefab(entity, prefab_id);
 		}
@@ -310,6 +341,7 @@ namespace NIKE {
 
 		//Set tag
 		entities.at(entity).tags.insert(tag);
+		tag_entities[Utility::internString(tag)].insert(entity);
 	}
 
 	void MetaData::Service::removeEntityTag(Entity::Type entity, std::string const& tag) {
@@ -328,6 +360,10 @@ namespace NIKE {
 
 		//Set tag
 		entities.at(entity).tags.erase(tag);
+		auto tag_it = tag_entities.find(Utility::hashString(tag));
+		if (tag_it != tag_entities.end()) {
+			tag_it->second.erase(entity);
+		}
 	}
 
 	void MetaData::Service::destroyEntity(Entity::Type entity) {
@@ -628,29 +664,33 @@ namespace NIKE {
 		}
 	}
 
-	std::set<std::string> MetaData::Service::getEntityTags(Entity::Type entity) {
+	std::set<std::string> const& MetaData::Service::getEntityTags(Entity::Type entity) const {
+		static const std::set<std::string> empty_tags;
+
 		//Check if entity exists
-		if (entities.find(entity) == entities.end()) {
+		auto it = entities.find(entity);
+		if (it == entities.end()) {
 			NIKEE_CORE_WARN("Entity does not exist");
-			return std::set<std::string>();
+			return empty_tags;
 		}
 
-		return entities.at(entity).tags;
+		return it->second.tags;
 	}
 
-	std::set<Entity::Type> MetaData::Service::getEntitiesByTag(std::string const& tag) const {
+	std::set<Entity::Type> const& MetaData::Service::getEntitiesByTag(std::string const& tag) const {
+		return getEntitiesByTag(Utility::hashString(tag));
+	}
 
-		//Set of entity
-		std::set<Entity::Type> type_entities;
+	std::set<Entity::Type> const& MetaData::Service::getEntitiesByTag(Utility::StringID tag_handle) const {
+		static const std::set<Entity::Type> empty_entities;
 
-		//Check if tag is present within entity
-		for (auto const& entity_data : entities) {
-			if (entity_data.second.tags.find(tag) != entity_data.second.tags.end()) {
-				type_entities.insert(entity_data.first);
-			}
+		//Look up tag index
+		auto it = tag_entities.find(tag_handle);
+		if (it == tag_entities.end()) {
+			return empty_entities;
 		}
 
-		return type_entities;
+		return it->second;
 	}
 
 	void MetaData::Service::cloneEntityData(Entity::Type entity, Entity::Type clone) {
@@ -661,11 +701,13 @@ namespace NIKE {
 		}
 
 		//Update with cloned meta data
+		unindexEntity(entity);
 		entities.at(entity).tags = it_clone->second.tags;
 		entities.at(entity).b_locked = it_clone->second.b_locked;
 		entities.at(entity).prefab_id = it_clone->second.prefab_id;
 		entities.at(entity).prefab_override = it_clone->second.prefab_override;
 		entities.at(entity).layer_id = it_clone->second.layer_id;
+		indexEntity(entity);
 	}
 
 	nlohmann::json MetaData::Service::serializeEntityData(Entity::Type entity) const {
@@ -683,7 +725,9 @@ namespace NIKE {
 			return;
 		}
 
+		unindexEntity(entity);
 		entities.at(entity).deserialize(data);
+		indexEntity(entity);
 	}
 
 	nlohmann::json MetaData::Service::serializePrefabData(MetaData::EntityData const& metadata) const {
@@ -860,7 +904,7 @@ namespace NIKE {
 		}
 
 		//Check if prefab id is valid
-		if (!entities.at(entity).prefab_id.empty() && entities.at(entity).prefab_id.find(".prefab") != std::string::npos) {
+		if (!entities.at(entity).prefab_id.empty() && entities.at(entity).prefab_id.getString().find(".prefab") != std::string::npos) {
 			//Load entity with prefab
 			NIKE_SERIALIZE_SERVICE->loadEntityFromPrefab(entity, prefab_id);
 		}
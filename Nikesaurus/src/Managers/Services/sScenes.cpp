@@ -44,59 +44,61 @@ namespace NIKE {
 			return NIKE_METADATA_SERVICE->getEntityLayerOrder(a) < NIKE_METADATA_SERVICE->getEntityLayerOrder(b);
 			});
 	}
+	bool Scenes::Layer::isYSortedBefore(YSortKey const& a, YSortKey const& b) {
+		if (!a.b_transform || !b.b_transform) return a.order < b.order;
+		return a.bottom > b.bottom;
+	}
 	void Scenes::Layer::sortEntitiesBasedOnYPosition() {
 		if (entities.empty()) return;
 
-		// Make a copy to sort
-		std::vector<Entity::Type> sortedEntities = entities;
-
-		// Step 1: Apply world transform for child entities
-		std::unordered_map<Entity::Type, Vector2f> originalOffsets;
-
-		for (auto& entity : sortedEntities) {
-			auto relation = NIKE_METADATA_SERVICE->getEntityRelation(entity);
-			auto* child = std::get_if<MetaData::Child>(&relation);
-			if (!child) continue;
-
-			auto parent = NIKE_METADATA_SERVICE->getEntityByName(child->parent);
-			if (!parent.has_value()) continue;
-
-			auto parentTransform = NIKE_ECS_MANAGER->getEntityComponent<Transform::Transform>(parent.value());
-			auto childTransform = NIKE_ECS_MANAGER->getEntityComponent<Transform::Transform>(entity);
-
-			if (!parentTransform || !childTransform) continue;
+		// Step 1: Cache sort keys, children are offset by parent position without writing to transforms
+		ysort_keys.clear();
+		ysort_keys.reserve(entities.size());
+		for (auto entity : entities) {
+			YSortKey key{ entity, 0.0f, NIKE_METADATA_SERVICE->getEntityLayerOrder(entity), false };
+
+			auto* transform = NIKE_ECS_MANAGER->tryGetEntityComponent<Transform::Transform>(entity);
+			if (transform) {
+				float position_y = transform->position.y;
+
+				auto relation = NIKE_METADATA_SERVICE->getEntityRelation(entity);
+				if (auto* child = std::get_if<MetaData::Child>(&relation)) {
+					auto parent = NIKE_METADATA_SERVICE->getEntityByName(child->parent);
+					auto* p_transform = parent.has_value() ? NIKE_ECS_MANAGER->tryGetEntityComponent<Transform::Transform>(parent.value()) : nullptr;
+					if (p_transform) position_y += p_transform->position.y;
+				}
 
-			auto& c_transform = childTransform.value().get();
-			const auto& p_transform = parentTransform.value().get();
+				key.bottom = position_y - (transform->scale.y * 0.5f);
+				key.b_transform = true;
+			}
 
-			originalOffsets[entity] = c_transform.position;
-			c_transform.position += p_transform.position;
+			ysort_keys.push_back(key);
 		}
 
-		// Step 2: Y-Sort based on world positions
-		std::sort(sortedEntities.begin(), sortedEntities.end(), [](Entity::Type a, Entity::Type b) {
-			size_t orderA = NIKE_METADATA_SERVICE->getEntityLayerOrder(a);
-			size_t orderB = NIKE_METADATA_SERVICE->getEntityLayerOrder(b);
-			const auto& transformA = NIKE_ECS_MANAGER->getEntityComponent<Transform::Transform>(a);
-			const auto& transformB = NIKE_ECS_MANAGER->getEntityComponent<Transform::Transform>(b);
-			if (!transformA || !transformB) return orderA < orderB;
-			const auto& tA = transformA.value().get();
-			const auto& tB = transformB.value().get();
-			float bottomA = tA.position.y - (tA.scale.y * 0.5f);
-			float bottomB = tB.position.y - (tB.scale.y * 0.5f);
-			return bottomA > bottomB;
-			});
+		// Step 2: Insertion sort, entities are kept in last frame's order so only moved entities shift
+		static constexpr size_t MAX_SHIFTS_PER_ENTITY = 8;
+		size_t shifts_left = ysort_keys.size() * MAX_SHIFTS_PER_ENTITY;
+		for (size_t i = 1; i < ysort_keys.size(); ++i) {
+			if (!isYSortedBefore(ysort_keys[i], ysort_keys[i - 1])) continue;
 
-		// Step 3: Restore local offsets for children
-		for (const auto& [entity, offset] : originalOffsets) {
-			auto c_trans = NIKE_ECS_MANAGER->getEntityComponent<Transform::Transform>(entity);
-			if (c_trans.has_value()) {
-				c_trans.value().get().position = offset;
+			YSortKey key = ysort_keys[i];
+			size_t j = i;
+			for (; j > 0 && shifts_left > 0 && isYSortedBefore(key, ysort_keys[j - 1]); --j, --shifts_left) {
+				ysort_keys[j] = ysort_keys[j - 1];
+			}
+			ysort_keys[j] = key;
+
+			// Order is far from sorted ( First frame after load ), sort everything in one go
+			if (shifts_left == 0) {
+				std::stable_sort(ysort_keys.begin(), ysort_keys.end(), isYSortedBefore);
+				break;
 			}
 		}
 
 		// Final update
-		entities = std::move(sortedEntities);
+		for (size_t i = 0; i < ysort_keys.size(); ++i) {
+			entities[i] = ysort_keys[i].entity;
+		}
 	}
 
 	void Scenes::Layer::setEntityOrder(Entity::Type entity, size_t order_in_layer) {
@@ -158,12 +160,21 @@ namespace NIKE {
 	/*****************************************************************//**
 	 * Scene manager functions
 	 *********************************************************************/
+	void Scenes::Service::loadCurrScene() {
+		//Rebuild script modules so module locals do not carry over between scene loads
+		NIKE_LUA_SERVICE->invalidateScriptModules();
+
+		//Load scene entities with a single EntitiesChanged dispatch
+		auto batch = NIKE_ECS_MANAGER->batchEntityChanges();
+		NIKE_ASSETS_SERVICE->getExecutable(curr_scene);
+	}
+
 	void Scenes::Service::initScene(std::string const& scene_id) {
 		curr_scene = scene_id;
 		prev_scene = curr_scene;
 		if (!NIKE_ASSETS_SERVICE->isAssetRegistered(curr_scene))
 			throw std::runtime_error("Error scene file does not exist");
-		NIKE_ASSETS_SERVICE->getExecutable(curr_scene);
+		loadCurrScene();
 
 		// Check for settings/options scene
 		if (curr_scene == "SettingsTest.scn") { // Use your actual settings scene filename
@@ -192,7 +203,7 @@ namespace NIKE {
 		NIKE_MAP_SERVICE->resetGrid();
 		layers.clear();
 		createLayer();
-		NIKE_ASSETS_SERVICE->getExecutable(curr_scene);
+		loadCurrScene();
 
 		// --- CALL FOOTSTEP HELPER ---
 		SetFootstepSoundsForScene(curr_scene);
@@ -248,7 +259,7 @@ namespace NIKE {
 		NIKE_CAMERA_SERVICE->clearCameraEntities();
 		layers.clear();
 		createLayer();
-		NIKE_ASSETS_SERVICE->getExecutable(curr_scene);
+		loadCurrScene();
 
 		// --- CALL FOOTSTEP HELPER ---
 		SetFootstepSoundsForScene(curr_scene);
@@ -301,7 +312,7 @@ namespace NIKE {
 		createLayer();
 		if (!NIKE_ASSETS_SERVICE->isAssetRegistered(curr_scene))
 			throw std::runtime_error("Error scene file does not exist");
-		NIKE_ASSETS_SERVICE->getExecutable(curr_scene);
+		loadCurrScene();
 	}
 
 	void Scenes::Service::pauseScene()
@@ -391,6 +402,15 @@ namespace NIKE {
 		return static_cast<unsigned int>(layers.size());
 	}
 	std::vector<std::shared_ptr<Scenes::Layer>>& Scenes::Service::getLayers() { return layers; }
+	void Scenes::Service::markInactiveLayerEntities(std::vector<bool>& b_inactive) const {
+		b_inactive.assign(Entity::MAX, false);
+		for (auto const& layer : layers) {
+			if (layer->getLayerState()) continue;
+			for (auto entity : layer->getEntitites()) {
+				b_inactive[entity] = true;
+			}
+		}
+	}
 	void Scenes::Service::queueSceneEvent(SceneEvent&& new_event) {
 		event_queue.push(std::move(new_event));
 
@@ -405,7 +425,7 @@ namespace NIKE {
 	std::string Scenes::Service::getPrevSceneID() const { return prev_scene; }
 	void Scenes::Service::restorePlayerData() {
 		if (saved_player_data.empty()) return;
-		std::set<Entity::Type> players = NIKE_METADATA_SERVICE->getEntitiesByTag("player");
+		std::set<Entity::Type> const& players = NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid);
 		if (players.empty()) return;
 		Entity::Type playerEntity = *players.begin();
 		NIKE_SERIALIZE_SERVICE->deserializePlayerData(playerEntity, saved_player_data);
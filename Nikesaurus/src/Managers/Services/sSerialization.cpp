@@ -639,6 +639,9 @@ namespace NIKE {
 						//Deserialize all entities
 						Entity::Type entity = NIKE_ECS_MANAGER->createEntity();
 
+						//Scene loads are batched, register metadata before the EntitiesChanged dispatch
+						NIKE_METADATA_SERVICE->registerEntity(entity);
+
 						//Deserialize entity metadata
 						if (e_data.at("Entity").contains("MetaData")) {
 
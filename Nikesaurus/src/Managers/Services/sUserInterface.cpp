@@ -162,12 +162,12 @@ namespace NIKE {
 			auto const& e_shape = e_shape_comp.value().get();
 
 			//Check if model is registered
-			if (!NIKE_ASSETS_SERVICE->isAssetRegistered(e_shape.model_id)) {
+			if (!NIKE_ASSETS_SERVICE->isAssetRegistered(e_shape.model_id.getID())) {
 				return false;
 			}
 
 			auto getVertices = [e_shape]() {
-				std::vector<Assets::Vertex>& vertices = NIKE_ASSETS_SERVICE->getAsset<Assets::Model>(e_shape.model_id)->vertices;
+				std::vector<Assets::Vertex>& vertices = NIKE_ASSETS_SERVICE->getAsset<Assets::Model>(e_shape.model_id.getID())->vertices;
 
 				std::vector<Vector2f> vert;
 				for (const Assets::Vertex& v : vertices) {
@@ -554,7 +554,7 @@ namespace NIKE {
 				auto it = ent.scripts.find(scriptName);
 				if (it != ent.scripts.end() && !it->second.script_id.empty()) {
 					it->second.named_args["entity"] = ent.entity_id; // Set entity default
-					NIKE_LUA_SERVICE->executeScript(it->second);
+					NIKE_LUA_SERVICE->executeScript(it->second, ent.entity_id);
 				}
 				};
 
@@ -19,38 +19,21 @@ namespace NIKE {
 
 	void Animation::Manager::update() {
 
-		//Iteration every fixed step for fixed delta time
-		for (int step = 0; step < NIKE_WINDOWS_SERVICE->getCurrentNumOfSteps(); ++step) {
-
-			//Iterate through layers
-			for (auto& layer : NIKE_SCENES_SERVICE->getLayers()) {
-
-				//SKip inactive layer
-				if (!layer->getLayerState())
-					continue;
+		//View of entities with a spritesheet animator ( Driven by the smallest of its pools )
+		auto sprite_view = NIKE_ECS_MANAGER->view<Animation::Base, Animation::Sprite, Render::Texture>();
 
-				//Iterate through all entities
-				for (auto& entity : layer->getEntitites()) {
+		//Skip entities of inactive layers
+		NIKE_SCENES_SERVICE->markInactiveLayerEntities(b_inactive_entities);
 
-					//Skip entity not registered to this system
-					if (entities.find(entity) == entities.end()) continue;
-
-					//Get base animator comp
-					auto e_baseanimator_comp = NIKE_ECS_MANAGER->getEntityComponent<Animation::Base>(entity);
-					if (!e_baseanimator_comp.has_value()) continue;
-					auto& e_baseanimator = e_baseanimator_comp.value().get();
+		//Iteration every fixed step for fixed delta time
+		for (int step = 0; step < NIKE_WINDOWS_SERVICE->getCurrentNumOfSteps(); ++step) {
 
-					//Update entities with spritesheet
-					auto e_spriteanimator_comp = NIKE_ECS_MANAGER->getEntityComponent<Animation::Sprite>(entity);
-					auto e_texture_comp = NIKE_ECS_MANAGER->getEntityComponent<Render::Texture>(entity);
-					if (e_spriteanimator_comp.has_value() && e_texture_comp.has_value()) {
-						auto& e_spriteanimator = e_spriteanimator_comp.value().get();
-						auto& e_texture = e_texture_comp.value().get();
+			//Iterate through entities with spritesheet
+			for (auto [entity, e_baseanimator, e_spriteanimator, e_texture] : sprite_view) {
+				if (b_inactive_entities[entity]) continue;
 
-						//Animate spritesheet
-						sprite_animator->animateSprite(e_baseanimator, e_spriteanimator, e_texture);
-					}
-				}
+				//Animate spritesheet
+				sprite_animator->animateSprite(e_baseanimator, e_spriteanimator, e_texture);
 			}
 		}
 	}
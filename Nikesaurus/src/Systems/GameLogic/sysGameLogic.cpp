@@ -21,7 +21,17 @@ namespace NIKE {
 	void GameLogic::Manager::update() 
 	{
 		// Handle status effects
-		for (auto& [entity, hasEffect] : statusEntities) {
+		for (auto it = statusEntities.begin(); it != statusEntities.end();) {
+			// Drop handles of destroyed entities
+			if (!NIKE_ECS_MANAGER->checkEntityHandle(it->first)) {
+				it = statusEntities.erase(it);
+				continue;
+			}
+
+			Entity::Type entity = Entity::getHandleEntity(it->first);
+			auto& hasEffect = it->second;
+			++it;
+
 			if (!hasEffect) continue; // Skip objects that haven't been hit
 
 			auto texture_comp = NIKE_ECS_MANAGER->getEntityComponent<Render::Texture>(entity);
@@ -44,7 +54,7 @@ namespace NIKE {
 		auto& layers = NIKE_SCENES_SERVICE->getLayers();
 
 		//Get Tags
-		auto background_tags = NIKE_METADATA_SERVICE->getEntitiesByTag("Background");
+		auto const& background_tags = NIKE_METADATA_SERVICE->getEntitiesByTag("Background"_sid);
 
 		//Reverse Iterate through layers
 		for (auto layer = layers.rbegin(); layer != layers.rend(); ++layer) {
@@ -97,11 +107,11 @@ namespace NIKE {
 					e_logic.script.named_args["entity"] = entity;
 
 					//Execute script
-					NIKE_LUA_SERVICE->executeScript(e_logic.script);
+					NIKE_LUA_SERVICE->executeScript(e_logic.script, entity);
 				}
 
 				// Player tag
-				auto player_entities = NIKE_METADATA_SERVICE->getEntitiesByTag("player");
+				auto const& player_entities = NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid);
 
 				updateStatusEffects(entity);
 
@@ -129,7 +139,7 @@ namespace NIKE {
 					}
 
 					// Enemy tag
-					auto enemy_tags = NIKE_METADATA_SERVICE->getEntitiesByTag("enemy");
+					auto const& enemy_tags = NIKE_METADATA_SERVICE->getEntitiesByTag("enemy"_sid);
 
 					static bool is_spawn_portal = false;
 
@@ -144,7 +154,7 @@ namespace NIKE {
 					if ((enemy_tags.empty() && e_spawner.enemies_spawned == e_spawner.enemy_limit) || 
 						is_spawn_portal)
 					{
-						auto overlay_text_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("screen_text");
+						auto const& overlay_text_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("screen_text"_sid);
 
 						// UI Overlay Opacity
 						for (const auto& overlay_entity : overlay_text_tag)
@@ -184,8 +194,8 @@ namespace NIKE {
 				}
 
 				// Elemental UI 
-				auto elem_ui_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("elementui");
-				auto hp_container_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("hpcontainer");
+				auto const& elem_ui_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("elementui"_sid);
+				auto const& hp_container_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("hpcontainer"_sid);
 
 				for (auto& elementui : elem_ui_tag) {
 					// If player not dead
@@ -219,7 +229,7 @@ namespace NIKE {
 				}
 
 				// Health bar logic
-				auto healthbar_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("healthbar");
+				auto const& healthbar_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("healthbar"_sid);
 
 				for (auto& healthbar : healthbar_tag) {
 
@@ -261,9 +271,9 @@ namespace NIKE {
 				}
 
 				// Boss entities and UI components
-				const auto boss_entities = NIKE_METADATA_SERVICE->getEntitiesByTag("boss");
-				const auto boss_healthbar_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("boss_healthbar");
-				const auto boss_hp_container_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("bosshpcontainer");
+				auto const& boss_entities = NIKE_METADATA_SERVICE->getEntitiesByTag("boss"_sid);
+				auto const& boss_healthbar_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("boss_healthbar"_sid);
+				auto const& boss_hp_container_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("bosshpcontainer"_sid);
 
 				if (!boss_entities.empty()) {
 					for (const auto& boss : boss_entities) {
@@ -386,7 +396,7 @@ namespace NIKE {
 			NIKEE_CORE_INFO("BURN TICK: -1 HP");
 		
 			NIKE_AUDIO_SERVICE->playAudio(sfxToPlay, "", NIKE_AUDIO_SERVICE->getSFXChannelGroupID(), 0.5f * NIKE_AUDIO_SERVICE->getGlobalSFXVolume(), 1.f, false, false);
-			statusEntities[entity] = true;
+			statusEntities[NIKE_ECS_MANAGER->getEntityHandle(entity)] = true;
 			// Set intensity to max (1.0f) when hit
 
 			if (texture_comp) {
@@ -400,7 +410,7 @@ namespace NIKE {
 		case Element::Status::FREEZE:
 			NIKEE_CORE_INFO("FROZEN TICK");
 			NIKE_AUDIO_SERVICE->playAudio(slowSfx, "", NIKE_AUDIO_SERVICE->getSFXChannelGroupID(), 0.5f * NIKE_AUDIO_SERVICE->getGlobalSFXVolume(), 1.f, false, false);
-			statusEntities[entity] = true;
+			statusEntities[NIKE_ECS_MANAGER->getEntityHandle(entity)] = true;
 			applyFreeze(e_dynamic.max_speed, e_dynamic.max_speed / 2, e_combo.temp_max_speed);
 			break;
 
@@ -408,7 +418,7 @@ namespace NIKE {
 			NIKEE_CORE_INFO("POISON TICK: -1 HP");
 
 			NIKE_AUDIO_SERVICE->playAudio(sfxToPlay, "", NIKE_AUDIO_SERVICE->getSFXChannelGroupID(), 0.5f * NIKE_AUDIO_SERVICE->getGlobalSFXVolume(), 1.f, false, false);
-			statusEntities[entity] = true;
+			statusEntities[NIKE_ECS_MANAGER->getEntityHandle(entity)] = true;
 
 			if (texture_comp) {
 				texture_comp.value().get().intensity = 1.0f;
@@ -462,7 +472,7 @@ namespace NIKE {
 		applyBurn(health, lifesteal_amount);
 
 		// Get all player entities
-		std::set<Entity::Type> player_entities = NIKE_METADATA_SERVICE->getEntitiesByTag("player");
+		std::set<Entity::Type> const& player_entities = NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid);
 
 		// Check if player alive
 		if (player_entities.empty()) {
@@ -498,7 +508,7 @@ namespace NIKE {
 
 	void GameLogic::Manager::resetHealth()
 	{
-		std::set<Entity::Type> players = NIKE_METADATA_SERVICE->getEntitiesByTag("player");
+		std::set<Entity::Type> const& players = NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid);
 		for (auto player : players)
 		{
 			auto health_comp = NIKE_ECS_MANAGER->getEntityComponent<Combat::Health>(player);
@@ -564,7 +574,7 @@ namespace NIKE {
 
 	void GameLogic::Manager::updateBGMCVolume() {
 		// Get the current enemy entities.
-		std::set<Entity::Type> enemy_tags = NIKE_METADATA_SERVICE->getEntitiesByTag("enemy");
+		std::set<Entity::Type> const& enemy_tags = NIKE_METADATA_SERVICE->getEntitiesByTag("enemy"_sid);
 
 		// Get the BGM and BGMC channel groups.
 		auto bgmGroup = NIKE_AUDIO_SERVICE->getChannelGroup(NIKE_AUDIO_SERVICE->getBGMChannelGroupID());
@@ -726,8 +736,8 @@ namespace NIKE {
 
 	void GameLogic::Manager::handlePortalInteractions(bool& is_spawn_portal, float& elapsed_time_before)
 	{
-		auto players = NIKE_METADATA_SERVICE->getEntitiesByTag("player");
-		auto vents_entities = NIKE_METADATA_SERVICE->getEntitiesByTag("vent");
+		auto const& players = NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid);
+		auto const& vents_entities = NIKE_METADATA_SERVICE->getEntitiesByTag("vent"_sid);
 
 		for (auto vent : vents_entities)
 		{
@@ -784,7 +794,7 @@ namespace NIKE {
 			}
 
 			// Portal Animation
-			if (texture.value().get().texture_id == "Front gate_animation_sprite.png" || texture.value().get().texture_id == "Frontdoor_animation_sprite.png")
+			if (texture.value().get().texture_id == "Front gate_animation_sprite.png"_sid || texture.value().get().texture_id == "Frontdoor_animation_sprite.png"_sid)
 				continue;
 
 			NIKE_AUDIO_SERVICE->playAudio("EnemySpawn1.wav", "", NIKE_AUDIO_SERVICE->getSFXChannelGroupID(), NIKE_AUDIO_SERVICE->getGlobalSFXVolume(), 1.f, false, false);
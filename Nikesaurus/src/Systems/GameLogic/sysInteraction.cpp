@@ -28,7 +28,7 @@ namespace NIKE {
             if (NIKE_INPUT_SERVICE->isKeyTriggered(NIKE_KEY_ESCAPE)) {
 
                 // Get player tag
-                std::set<Entity::Type> player_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("player");
+                std::set<Entity::Type> const& player_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid);
 
                 // Prevent pausing when there is no player
                 if (player_tag.empty()) {
@@ -76,8 +76,8 @@ namespace NIKE {
             }
 
             // Get tags
-            auto player_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("player");
-            auto heal_animation_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("healAnimation");
+            auto const& player_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("player"_sid);
+            auto const& heal_animation_tag = NIKE_METADATA_SERVICE->getEntitiesByTag("healAnimation"_sid);
 
             handleScreenOverlay();
 
@@ -98,7 +98,17 @@ namespace NIKE {
             //}
 
             // When hitting objects
-            for (auto& [entity, isHit] : hitEntities) {
+            for (auto it = hitEntities.begin(); it != hitEntities.end();) {
+                // Drop handles of destroyed entities
+                if (!NIKE_ECS_MANAGER->checkEntityHandle(it->first)) {
+                    it = hitEntities.erase(it);
+                    continue;
+                }
+
+                Entity::Type entity = Entity::getHandleEntity(it->first);
+                auto& isHit = it->second;
+                ++it;
+
                 if (!isHit) continue; // Skip objects that haven't been hit
 
                 auto texture_comp = NIKE_ECS_MANAGER->getEntityComponent<Render::Texture>(entity);
@@ -476,7 +486,7 @@ namespace NIKE {
 
         void handleScreenOverlay() {
 
-            auto screen_overlay = NIKE_METADATA_SERVICE->getEntitiesByTag("portal_ui");
+            auto const& screen_overlay = NIKE_METADATA_SERVICE->getEntitiesByTag("portal_ui"_sid);
             
             bool in_range = false;
             for (auto& [entity, inRange] : NIKE_UI_SERVICE->inRangeEntities) {
@@ -849,7 +859,7 @@ namespace NIKE {
                 std::string sfxToPlay = "Enemy_Pawn_Hit_0" + std::to_string(randomVariant) + ".wav";
                 NIKE_AUDIO_SERVICE->playAudio(sfxToPlay, "", NIKE_AUDIO_SERVICE->getSFXChannelGroupID(), 0.5f * NIKE_AUDIO_SERVICE->getGlobalSFXVolume(), 1.f, false, false);
                 // Set entity hit boolean to true
-                hitEntities[target] = true;
+                hitEntities[NIKE_ECS_MANAGER->getEntityHandle(target)] = true;
 
                 // Set intensity to max (1.0f) when hit
                 auto texture_comp = NIKE_ECS_MANAGER->getEntityComponent<Render::Texture>(target);
@@ -864,7 +874,7 @@ namespace NIKE {
                 NIKE_AUDIO_SERVICE->playAudio(sfxToPlay, "", NIKE_AUDIO_SERVICE->getSFXChannelGroupID(), 0.6f * NIKE_AUDIO_SERVICE->getGlobalSFXVolume(), 1.f, false, false);
 
                 // Set entity hit boolean to true
-                hitEntities[target] = true;
+                hitEntities[NIKE_ECS_MANAGER->getEntityHandle(target)] = true;
 
                 // Set intensity to max (1.0f) when hit
                 auto texture_comp = NIKE_ECS_MANAGER->getEntityComponent<Render::Texture>(target);
@@ -878,7 +888,7 @@ namespace NIKE {
 
 
                 // Set entity hit boolean to true
-                hitEntities[target] = true;
+                hitEntities[NIKE_ECS_MANAGER->getEntityHandle(target)] = true;
 
                 // Set intensity to max (1.0f) when hit
                 auto texture_comp = NIKE_ECS_MANAGER->getEntityComponent<Render::Texture>(target);
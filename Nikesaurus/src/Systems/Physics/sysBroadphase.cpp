@@ -0,0 +1,323 @@
+/*****************************************************************//**
+ * \file   sysBroadphase.cpp
+ * \brief  Uniform grid spatial hash broadphase for physics
+ *
+ * \author agent, agent@local (100%)
+ * \date   October 2026
+ * All content © 2026 DigiPen Institute of Technology Singapore, all rights reserved.
+ *********************************************************************/
+
+#include "Core/stdafx.h"
+#include "Systems/Physics/sysBroadphase.h"
+
+namespace NIKE {
+
+    Broadphase::SpatialHash::SpatialHash()
+        : cell_size{ 100.0f, 100.0f }, proxies(Entity::MAX), curr_stamp{ 0 } {
+    }
+
+    uint64_t Broadphase::SpatialHash::cellKey(int x, int y) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(y));
+    }
+
+    Vector2i Broadphase::SpatialHash::toCell(Vector2f const& position) const {
+        return { static_cast<int>(std::floor(position.x / cell_size.x)), static_cast<int>(std::floor(position.y / cell_size.y)) };
+    }
+
+    void Broadphase::SpatialHash::insertIntoCells(Entity::Type entity) {
+        auto const& proxy = proxies[entity];
+        for (int y = proxy.cell_min.y; y <= proxy.cell_max.y; ++y) {
+            for (int x = proxy.cell_min.x; x <= proxy.cell_max.x; ++x) {
+                buckets[cellKey(x, y)].push_back(entity);
+            }
+        }
+    }
+
+    void Broadphase::SpatialHash::removeFromCells(Entity::Type entity) {
+        auto const& proxy = proxies[entity];
+        for (int y = proxy.cell_min.y; y <= proxy.cell_max.y; ++y) {
+            for (int x = proxy.cell_min.x; x <= proxy.cell_max.x; ++x) {
+                auto it = buckets.find(cellKey(x, y));
+                if (it == buckets.end()) continue;
+
+                // Swap and pop entity out of bucket
+                auto& bucket = it->second;
+                auto e_it = std::find(bucket.begin(), bucket.end(), entity);
+                if (e_it != bucket.end()) {
+                    *e_it = bucket.back();
+                    bucket.pop_back();
+                }
+
+                // Drop empty buckets so the map only holds occupied cells
+                if (bucket.empty()) {
+                    buckets.erase(it);
+                }
+            }
+        }
+    }
+
+    void Broadphase::SpatialHash::removeProxy(Entity::Type entity) {
+        auto& proxy = proxies[entity];
+        if (!proxy.b_active) return;
+
+        if (proxy.b_oversized) {
+            oversized_entities.erase(std::find(oversized_entities.begin(), oversized_entities.end(), entity));
+        }
+        else {
+            removeFromCells(entity);
+        }
+
+        bool b_listed = proxy.b_listed;
+        proxy = Proxy();
+        proxy.b_listed = b_listed;
+    }
+
+    bool Broadphase::SpatialHash::boundsOverlap(Proxy const& a, Proxy const& b) {
+        return !(a.bounds_max.x < b.bounds_min.x || a.bounds_min.x > b.bounds_max.x ||
+            a.bounds_max.y < b.bounds_min.y || a.bounds_min.y > b.bounds_max.y);
+    }
+
+    bool Broadphase::SpatialHash::isPotentialPair(Proxy const& a, Proxy const& b) const {
+        if (a.mobility != Mobility::AWAKE && b.mobility != Mobility::AWAKE)
+            return false;
+
+        return boundsOverlap(a, b);
+    }
+
+    void Broadphase::SpatialHash::setCellSize(Vector2f const& size) {
+        if (size.x <= 0.0f || size.y <= 0.0f || (size.x == cell_size.x && size.y == cell_size.y))
+            return;
+
+        // Rebucket all grid proxies under the new cell size
+        buckets.clear();
+        cell_size = size;
+        for (auto entity : active_entities) {
+            auto& proxy = proxies[entity];
+            if (proxy.b_oversized) continue;
+            proxy.cell_min = toCell(proxy.bounds_min);
+            proxy.cell_max = toCell(proxy.bounds_max);
+            insertIntoCells(entity);
+        }
+    }
+
+    void Broadphase::SpatialHash::beginFrame() {
+        ++curr_stamp;
+    }
+
+    void Broadphase::SpatialHash::updateProxy(Entity::Type entity, Vector2f const& bounds_min, Vector2f const& bounds_max, Mobility mobility) {
+        auto& proxy = proxies[entity];
+        bool b_oversized = (bounds_max.x - bounds_min.x) >= OVERSIZED_EXTENT || (bounds_max.y - bounds_min.y) >= OVERSIZED_EXTENT;
+
+        // Re-insert proxy when it changes bucket type
+        if (proxy.b_active && proxy.b_oversized != b_oversized) {
+            removeProxy(entity);
+        }
+
+        // New proxy
+        if (!proxy.b_active) {
+            proxy.b_active = true;
+            proxy.b_oversized = b_oversized;
+            proxy.bounds_min = bounds_min;
+            proxy.bounds_max = bounds_max;
+            proxy.stamp = curr_stamp;
+            proxy.mobility = mobility;
+
+            if (!proxy.b_listed) {
+                proxy.b_listed = true;
+                active_entities.push_back(entity);
+            }
+
+            if (mobility == Mobility::STATIC) {
+                moved_static_entities.push_back(entity);
+            }
+
+            if (b_oversized) {
+                oversized_entities.push_back(entity);
+            }
+            else {
+                proxy.cell_min = toCell(bounds_min);
+                proxy.cell_max = toCell(bounds_max);
+                insertIntoCells(entity);
+            }
+            return;
+        }
+
+        // Existing proxy
+        if (mobility == Mobility::STATIC && (proxy.mobility != Mobility::STATIC || proxy.bounds_min != bounds_min || proxy.bounds_max != bounds_max)) {
+            moved_static_entities.push_back(entity);
+        }
+        proxy.bounds_min = bounds_min;
+        proxy.bounds_max = bounds_max;
+        proxy.stamp = curr_stamp;
+        proxy.mobility = mobility;
+        if (b_oversized) return;
+
+        // Only rebucket when cell range changes
+        Vector2i cell_min = toCell(bounds_min);
+        Vector2i cell_max = toCell(bounds_max);
+        if (cell_min == proxy.cell_min && cell_max == proxy.cell_max) return;
+
+        removeFromCells(entity);
+        proxy.cell_min = cell_min;
+        proxy.cell_max = cell_max;
+        insertIntoCells(entity);
+    }
+
+    void Broadphase::SpatialHash::endFrame() {
+        // Prune proxies of entities no longer simulated
+        for (size_t i = 0; i < active_entities.size();) {
+            if (proxies[active_entities[i]].stamp != curr_stamp) {
+                removeProxy(active_entities[i]);
+                proxies[active_entities[i]].b_listed = false;
+                active_entities[i] = active_entities.back();
+                active_entities.pop_back();
+            }
+            else {
+                ++i;
+            }
+        }
+    }
+
+    void Broadphase::SpatialHash::wakeSleeping(std::vector<Entity::Type>& woken) {
+        woken.clear();
+
+        auto wake = [&](Proxy const& moved, Entity::Type entity) {
+            auto& proxy = proxies[entity];
+            if (proxy.mobility != Mobility::SLEEPING || !boundsOverlap(moved, proxy)) return;
+            proxy.mobility = Mobility::AWAKE;
+            woken.push_back(entity);
+            };
+
+        for (auto moved_entity : moved_static_entities) {
+            auto const& moved = proxies[moved_entity];
+            if (!moved.b_active || moved.mobility != Mobility::STATIC) continue;
+
+            // Oversized static against every proxy
+            if (moved.b_oversized) {
+                for (auto entity : active_entities) {
+                    wake(moved, entity);
+                }
+                continue;
+            }
+
+            // Proxies sharing a cell, then oversized proxies
+            for (int y = moved.cell_min.y; y <= moved.cell_max.y; ++y) {
+                for (int x = moved.cell_min.x; x <= moved.cell_max.x; ++x) {
+                    auto it = buckets.find(cellKey(x, y));
+                    if (it == buckets.end()) continue;
+                    for (auto entity : it->second) {
+                        wake(moved, entity);
+                    }
+                }
+            }
+            for (auto large : oversized_entities) {
+                wake(moved, large);
+            }
+        }
+        moved_static_entities.clear();
+
+        std::sort(woken.begin(), woken.end());
+    }
+
+    void Broadphase::SpatialHash::queryPairs(std::vector<std::pair<Entity::Type, Entity::Type>>& pairs) const {
+        pairs.clear();
+
+        // Pairs sharing a grid cell
+        for (auto const& [key, bucket] : buckets) {
+            for (size_t i = 0; i < bucket.size(); ++i) {
+                for (size_t j = i + 1; j < bucket.size(); ++j) {
+                    if (!isPotentialPair(proxies[bucket[i]], proxies[bucket[j]])) continue;
+                    pairs.push_back(Utility::getMinMax(bucket[i], bucket[j]));
+                }
+            }
+        }
+
+        // Oversized proxies against every other proxy
+        for (auto large : oversized_entities) {
+            for (auto entity : active_entities) {
+                if (entity == large) continue;
+                if (!isPotentialPair(proxies[large], proxies[entity])) continue;
+                pairs.push_back(Utility::getMinMax(large, entity));
+            }
+        }
+
+        // Deduplicate pairs spanning multiple cells
+        std::sort(pairs.begin(), pairs.end());
+        pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+    }
+
+    void Broadphase::SpatialHash::querySegment(Vector2f const& start, Vector2f const& end, Vector2f const& half_extent, std::vector<Entity::Type>& entities) const {
+        entities.clear();
+
+        // Cells around the path covered by the box extent
+        Vector2i reach = {
+            static_cast<int>(std::ceil(half_extent.x / cell_size.x)),
+            static_cast<int>(std::ceil(half_extent.y / cell_size.y))
+        };
+
+        auto gatherCells = [&](Vector2i const& cell) {
+            for (int y = cell.y - reach.y; y <= cell.y + reach.y; ++y) {
+                for (int x = cell.x - reach.x; x <= cell.x + reach.x; ++x) {
+                    auto it = buckets.find(cellKey(x, y));
+                    if (it == buckets.end()) continue;
+                    entities.insert(entities.end(), it->second.begin(), it->second.end());
+                }
+            }
+            };
+
+        // Walk cells along the path ( grid DDA )
+        Vector2f delta = end - start;
+        Vector2i cell = toCell(start);
+        Vector2i last = toCell(end);
+        Vector2i step = { delta.x > 0.0f ? 1 : -1, delta.y > 0.0f ? 1 : -1 };
+
+        constexpr float INF = std::numeric_limits<float>::infinity();
+        Vector2f t_max = {
+            delta.x != 0.0f ? ((cell.x + (step.x > 0 ? 1 : 0)) * cell_size.x - start.x) / delta.x : INF,
+            delta.y != 0.0f ? ((cell.y + (step.y > 0 ? 1 : 0)) * cell_size.y - start.y) / delta.y : INF
+        };
+        Vector2f t_delta = {
+            delta.x != 0.0f ? cell_size.x / std::abs(delta.x) : INF,
+            delta.y != 0.0f ? cell_size.y / std::abs(delta.y) : INF
+        };
+
+        int cells_left = std::abs(last.x - cell.x) + std::abs(last.y - cell.y);
+        gatherCells(cell);
+        for (; cells_left > 0; --cells_left) {
+            if (t_max.x < t_max.y) {
+                cell.x += step.x;
+                t_max.x += t_delta.x;
+            }
+            else {
+                cell.y += step.y;
+                t_max.y += t_delta.y;
+            }
+            gatherCells(cell);
+        }
+
+        // Oversized proxies overlapping the swept box
+        Vector2f path_min = { Utility::getMin(start.x, end.x) - half_extent.x, Utility::getMin(start.y, end.y) - half_extent.y };
+        Vector2f path_max = { Utility::getMax(start.x, end.x) + half_extent.x, Utility::getMax(start.y, end.y) + half_extent.y };
+        for (auto large : oversized_entities) {
+            auto const& proxy = proxies[large];
+            if (proxy.bounds_max.x < path_min.x || proxy.bounds_min.x > path_max.x ||
+                proxy.bounds_max.y < path_min.y || proxy.bounds_min.y > path_max.y) continue;
+            entities.push_back(large);
+        }
+
+        // Deduplicate proxies spanning multiple cells
+        std::sort(entities.begin(), entities.end());
+        entities.erase(std::unique(entities.begin(), entities.end()), entities.end());
+    }
+
+    void Broadphase::SpatialHash::clear() {
+        for (auto entity : active_entities) {
+            proxies[entity] = Proxy();
+        }
+        active_entities.clear();
+        oversized_entities.clear();
+        moved_static_entities.clear();
+        buckets.clear();
+    }
+
+} // namespace NIKE
@@ -11,6 +11,12 @@
 #include "Core/Engine.h"
 #include "Systems/Physics/sysCollision.h"
 
+//SSE batched narrowphase
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define NIKE_COLLISION_SSE
+#endif
+
 namespace NIKE {
 
     void Collision::System::bounceResolution(
@@ -80,155 +86,33 @@ namespace NIKE {
         return restitution;
     }
 
-    bool Collision::System::detectAABBRectRect(
-        Physics::Dynamics const& dynamics_a, Physics::Collider const& collider_a,
-        Physics::Dynamics const& dynamics_b, Physics::Collider const& collider_b,
-        CollisionInfo& info) {
-
-        // References to components
-        bool a_flip = static_cast<int>(collider_a.transform.rotation) % 90 == 0 && static_cast<int>(collider_a.transform.rotation) % 180 != 0;
-        bool b_flip = static_cast<int>(collider_b.transform.rotation) % 90 == 0 && static_cast<int>(collider_b.transform.rotation) % 180 != 0;
-
-        AABB aabb_a({
-            collider_a.transform.position.x - (a_flip ? (collider_a.transform.scale.y * 0.5f) : (collider_a.transform.scale.x * 0.5f)),
-            collider_a.transform.position.y - (a_flip ? (collider_a.transform.scale.x * 0.5f) : (collider_a.transform.scale.y * 0.5f))
-            }, {
-                collider_a.transform.position.x + (a_flip ? (collider_a.transform.scale.y * 0.5f) : (collider_a.transform.scale.x * 0.5f)),
-                collider_a.transform.position.y + (a_flip ? (collider_a.transform.scale.x * 0.5f) : (collider_a.transform.scale.y * 0.5f))
-            });
-
-            AABB aabb_b({
-                collider_b.transform.position.x - (b_flip ? (collider_b.transform.scale.y * 0.5f) : (collider_b.transform.scale.x * 0.5f)),
-                collider_b.transform.position.y - (b_flip ? (collider_b.transform.scale.x * 0.5f) : (collider_b.transform.scale.y * 0.5f))
-                }, {
-                    collider_b.transform.position.x + (b_flip ? (collider_b.transform.scale.y * 0.5f) : (collider_b.transform.scale.x * 0.5f)),
-                    collider_b.transform.position.y + (b_flip ? (collider_b.transform.scale.x * 0.5f) : (collider_b.transform.scale.y * 0.5f))
-                });
-
-                // Get delta time
-                const float delta_time = NIKE_ENGINE.getService<Windows::Service>()->getFixedDeltaTime();
-
-                // Step 1: Static collision detection
-                if (!(aabb_a.rect_max.x < aabb_b.rect_min.x || aabb_a.rect_min.x > aabb_b.rect_max.x ||
-                    aabb_a.rect_max.y < aabb_b.rect_min.y || aabb_a.rect_min.y > aabb_b.rect_max.y)) {
-
-                    // Calculate overlaps on each axis
-                    float overlapX = Utility::getMin(
-                        aabb_a.rect_max.x - aabb_b.rect_min.x, aabb_b.rect_max.x - aabb_a.rect_min.x);
-                    float overlapY = Utility::getMin(
-                        aabb_a.rect_max.y - aabb_b.rect_min.y, aabb_b.rect_max.y - aabb_a.rect_min.y);
-
-                    // Determine MTV direction and smallest overlap
-                    Vector2f mtv_dir;
-                    if (overlapX < overlapY) {
-                        mtv_dir = { (aabb_a.rect_min.x < aabb_b.rect_min.x ? -1.0f : 1.0f), 0.0f };
-                    }
-                    else {
-                        mtv_dir = { 0.0f, (aabb_a.rect_min.y < aabb_b.rect_min.y ? -1.0f : 1.0f) };
-                    }
-
-                    // Set MTV and collision normal
-                    info.mtv = {
-                        mtv_dir.x * (overlapX < overlapY ? overlapX : overlapY),
-                        mtv_dir.y * (overlapX < overlapY ? overlapX : overlapY)
-                    };
-                    info.collision_normal = mtv_dir;
-
-                    info.t_first = 0.0f; // Static collision occurs
-                    return true;
-                }
-
-                // Step 2: Dynamic collision detection
-                Vector2f vel_rel = dynamics_a.velocity - dynamics_b.velocity;
-
-                // Initialize time of first and last collision along each axis
-                Vector2f t_first = { 0.0f, 0.0f };
-                Vector2f t_last = { delta_time, delta_time };
-
-                // Check dynamic collision along x-axis
-                if (std::abs(vel_rel.x) > EPSILON) {
-                    if (vel_rel.x > 0) {
-                        t_first.x = (aabb_a.rect_min.x - aabb_b.rect_max.x) / vel_rel.x;
-                        t_last.x = (aabb_a.rect_max.x - aabb_b.rect_min.x) / vel_rel.x;
-                    }
-                    else {
-                        t_first.x = (aabb_a.rect_max.x - aabb_b.rect_min.x) / vel_rel.x;
-                        t_last.x = (aabb_a.rect_min.x - aabb_b.rect_max.x) / vel_rel.x;
-                    }
-                }
-                else if (aabb_a.rect_max.x < aabb_b.rect_min.x || aabb_a.rect_min.x > aabb_b.rect_max.x) {
-                    return false; // No collision along x-axis
-                }
-
-                // Check dynamic collision along y-axis
-                if (std::abs(vel_rel.y) > EPSILON) {
-                    if (vel_rel.y > 0) {
-                        t_first.y = (aabb_a.rect_max.y - aabb_b.rect_min.y) / vel_rel.y;
-                        t_last.y = (aabb_a.rect_min.y - aabb_b.rect_max.y) / vel_rel.y;
-                    }
-                    else {
-                        t_first.y = (aabb_a.rect_min.y - aabb_b.rect_max.y) / vel_rel.y;
-                        t_last.y = (aabb_a.rect_max.y - aabb_b.rect_min.y) / vel_rel.y;
-                    }
-                }
-                else if (aabb_a.rect_max.y < aabb_b.rect_min.y || aabb_a.rect_min.y > aabb_b.rect_max.y) {
-                    return false; // No collision along y-axis
-                }
-
-                // Verify if collisions occur within the time frame
-                float t_first_overall = Utility::getMax(t_first.x, t_first.y);
-                float t_last_overall = Utility::getMin(t_last.x, t_last.y);
-
-                if (t_first_overall > t_last_overall || t_first_overall > delta_time) {
-                    return false; // No collision detected
-                }
-
-                // Update collision info
-                info.t_first = t_first_overall;
-                info.collision_normal = vel_rel.normalize();
-                return true;
-    }
-
     // SAT helper functions
 
-    // Helper to retrieve and apply transformations to vertices based on model_id
-    std::vector<Vector2f> Collision::System::getRotatedVertices(
-        const Physics::Collider& collider, const std::string& model_id)
-    {
-        // Initialize vertex list based on model type
-        std::vector<Vector2f> vertices;
-
-        // quad models
-        constexpr std::array<const char*, 4> QUAD_MODELS{
-            "square.model",
-            "square-texture.model",
-            "batched_square.model",
-            "batched_texture.model"
-        };
-
+    // Helper to compute collider AABB, rotated vertices and separating axes once per step
+    void Collision::System::cacheCollider(const Physics::Collider& collider, const std::string& model_id, ColliderCache& cache) {
+        // AABB ( extents swap for 90 & 270 degree rotations )
+        int rotation = static_cast<int>(collider.transform.rotation);
+        bool flip = rotation % 90 == 0 && rotation % 180 != 0;
+        Vector2f half_extent = flip
+            ? Vector2f(collider.transform.scale.y * 0.5f, collider.transform.scale.x * 0.5f)
+            : Vector2f(collider.transform.scale.x * 0.5f, collider.transform.scale.y * 0.5f);
+        cache.aabb_min = collider.transform.position - half_extent;
+        cache.aabb_max = collider.transform.position + half_extent;
+        cache.b_axis_aligned = (rotation % 90) == 0;
+
+        // Local vertices based on model type ( fallback default to square )
         if (model_id == "triangle.model") {
-            vertices = {
-                Vector2f(-0.5f, -0.5f),
-                Vector2f(0.5f, -0.5f),
-                Vector2f(0.0f, 0.5f)
-            };
-        }
-        else if (std::find(QUAD_MODELS.begin(), QUAD_MODELS.end(), model_id) != QUAD_MODELS.end()) {
-            vertices = {
-                Vector2f(0.5f, -0.5f),
-                Vector2f(0.5f, 0.5f),
-                Vector2f(-0.5f, 0.5f),
-                Vector2f(-0.5f, -0.5f)
-            };
+            cache.vertex_count = 3;
+            cache.vertices[0] = Vector2f(-0.5f, -0.5f);
+            cache.vertices[1] = Vector2f(0.5f, -0.5f);
+            cache.vertices[2] = Vector2f(0.0f, 0.5f);
         }
-        //Fallback default to square
         else {
-            vertices = {
-                Vector2f(0.5f, -0.5f),
-                Vector2f(0.5f, 0.5f),
-                Vector2f(-0.5f, 0.5f),
-                Vector2f(-0.5f, -0.5f)
-            };
+            cache.vertex_count = 4;
+            cache.vertices[0] = Vector2f(0.5f, -0.5f);
+            cache.vertices[1] = Vector2f(0.5f, 0.5f);
+            cache.vertices[2] = Vector2f(-0.5f, 0.5f);
+            cache.vertices[3] = Vector2f(-0.5f, -0.5f);
         }
 
         // Apply scaling and rotation based on Collider properties
@@ -239,7 +123,9 @@ namespace NIKE {
         Vector2f position = collider.transform.position; // Collider's position is independent of Transform
         Vector2f scale = collider.transform.scale;
 
-        for (Vector2f& vertex : vertices) {
+        for (int i = 0; i < cache.vertex_count; ++i) {
+            Vector2f& vertex = cache.vertices[i];
+
             // Scale the vertex
             vertex.x *= scale.x;
             vertex.y *= scale.y;
@@ -253,45 +139,24 @@ namespace NIKE {
             vertex.y = position.y + rotatedY;
         }
 
-        return vertices;
-    }
-
-    // Helper to retrieve separating axes from two sets of vertices
-    std::vector<Vector2f> Collision::System::getSeparatingAxes(
-        const std::vector<Vector2f>& verticesA, const std::vector<Vector2f>& verticesB)
-    {
-        std::vector<Vector2f> axes;
-
-        // Lambda to extract perpendicular axes from edges
-        auto addAxesFromEdges = [&](const std::vector<Vector2f>& vertices) {
-            for (size_t i = 0; i < vertices.size(); ++i) {
-                // Calculate the edge vector
-                Vector2f edge = vertices[(i + 1) % vertices.size()] - vertices[i];
-                Vector2f axis(-edge.y, edge.x); // Perpendicular to the edge
-
-                // Normalize the axis
-                axis = axis.normalize();
-                axes.push_back(axis);
-            }
-            };
-
-        // Extract axes from both shapes
-        addAxesFromEdges(verticesA);
-        addAxesFromEdges(verticesB);
-
-        return axes;
+        // Extract perpendicular axes from edges
+        for (int i = 0; i < cache.vertex_count; ++i) {
+            Vector2f edge = cache.vertices[(i + 1) % cache.vertex_count] - cache.vertices[i];
+            Vector2f axis(-edge.y, edge.x); // Perpendicular to the edge
+            cache.axes[i] = axis.normalize();
+        }
     }
 
     // Helper to project vertices onto a given axis and find the min/max projection values
     void Collision::System::projectVerticesOnAxis(
-        const std::vector<Vector2f>& vertices, const Vector2f& axis, float& min, float& max)
+        ColliderCache const& cache, const Vector2f& axis, float& min, float& max)
     {
         // Project the first vertex
-        min = max = axis.dot(vertices[0]);
+        min = max = axis.dot(cache.vertices[0]);
 
         // Project all vertices onto the axis
-        for (const Vector2f& vertex : vertices) {
-            float projection = axis.dot(vertex);
+        for (int i = 1; i < cache.vertex_count; ++i) {
+            float projection = axis.dot(cache.vertices[i]);
 
             // Update min and max projections
             if (projection < min) min = projection;
@@ -304,59 +169,237 @@ namespace NIKE {
         }
     }
 
-    // Main detect SAT function
-    bool Collision::System::detectSATCollision(
-        const Physics::Collider& colliderA, const Physics::Collider& colliderB,
-        const std::string& model_idA, const std::string& model_idB, CollisionInfo& info)
+    // Detect SAT collision on cached colliders
+    bool Collision::System::detectSATCollision(ColliderCache const& cache_a, Vector2f const& position_a,
+        ColliderCache const& cache_b, Vector2f const& position_b, CollisionInfo& info)
     {
-        // Step 1: Get vertices and separating axes
-        std::vector<Vector2f> verticesA = getRotatedVertices(colliderA, model_idA);
-        std::vector<Vector2f> verticesB = getRotatedVertices(colliderB, model_idB);
-        std::vector<Vector2f> axes = getSeparatingAxes(verticesA, verticesB);
-
         Vector2f smallestAxis;
-        bool collisionDetected = true;
         float minOverlap = FLT_MAX;
 
-        // Step 2: Project shapes onto each axis to find overlap
-        for (const Vector2f& axis : axes) {
-            float minA, maxA, minB, maxB;
-            projectVerticesOnAxis(verticesA, axis, minA, maxA);
-            projectVerticesOnAxis(verticesB, axis, minB, maxB);
+        // Project shapes onto each axis of both shapes to find overlap
+        auto testAxes = [&](ColliderCache const& source) {
+            for (int i = 0; i < source.vertex_count; ++i) {
+                Vector2f const& axis = source.axes[i];
+                float minA, maxA, minB, maxB;
+                projectVerticesOnAxis(cache_a, axis, minA, maxA);
+                projectVerticesOnAxis(cache_b, axis, minB, maxB);
+
+                // Check for separation
+                if (maxA < minB || maxB < minA) {
+                    return false;
+                }
 
-            // Check for separation
-            if (maxA < minB || maxB < minA) {
-                collisionDetected = false;
-                break;
+                // Calculate overlap distance
+                float overlap = Utility::getMin(maxA, maxB) - Utility::getMax(minA, minB);
+
+                // Track the smallest overlap
+                if (overlap < minOverlap) {
+                    minOverlap = overlap;
+                    smallestAxis = axis;
+                }
             }
+            return true;
+            };
+
+        if (!testAxes(cache_a) || !testAxes(cache_b)) {
+            return false;
+        }
 
-            // Calculate overlap distance
-            float overlap = Utility::getMin(maxA, maxB) - Utility::getMax(minA, minB);
+        // Calculate consistent MTV direction based on relative position
+        Vector2f relativePosition = position_a - position_b;
+        float biasFactor = 0.001f;
 
-            // Track the smallest overlap
-            if (overlap < minOverlap) {
-                minOverlap = overlap;
-                smallestAxis = axis;
+        if (relativePosition.dot(smallestAxis) < 0) {
+            // Flip axis to ensure consistent direction away from the stationary object
+            smallestAxis = { -smallestAxis.x, -smallestAxis.y };
+        }
+
+        // Adjust MTV and normal
+        info.mtv = (smallestAxis * minOverlap) + (smallestAxis * biasFactor);
+        info.collision_normal = smallestAxis.normalize();
+
+        return true;
+    }
+
+    //Batched AABB narrowphase
+
+    void Collision::AABBBatch::clear() {
+        count = 0;
+    }
+
+    void Collision::AABBBatch::push(ColliderCache const& a, Vector2f const& vel_a, ColliderCache const& b, Vector2f const& vel_b) {
+        // Grow arrays in lanes of 4 so the SIMD loop never reads past the end
+        if (count >= a_min_x.size()) {
+            size_t new_size = (count + 4) & ~static_cast<size_t>(3);
+            for (auto* arr : { &a_min_x, &a_min_y, &a_max_x, &a_max_y, &b_min_x, &b_min_y, &b_max_x, &b_max_y, &vel_x, &vel_y, &t_first }) {
+                arr->resize(new_size, 0.0f);
             }
+            hit.resize(new_size, 0);
         }
 
-        // Step 3: If collision is detected, assign the MTV and collision normal
-        if (collisionDetected) {
-            // Calculate consistent MTV direction based on relative position
-            Vector2f relativePosition = colliderA.transform.position - colliderB.transform.position;
-            float biasFactor = 0.001f;
+        a_min_x[count] = a.aabb_min.x;
+        a_min_y[count] = a.aabb_min.y;
+        a_max_x[count] = a.aabb_max.x;
+        a_max_y[count] = a.aabb_max.y;
+        b_min_x[count] = b.aabb_min.x;
+        b_min_y[count] = b.aabb_min.y;
+        b_max_x[count] = b.aabb_max.x;
+        b_max_y[count] = b.aabb_max.y;
+        vel_x[count] = vel_a.x - vel_b.x;
+        vel_y[count] = vel_a.y - vel_b.y;
+        ++count;
+    }
 
-            if (relativePosition.dot(smallestAxis) < 0) {
-                // Flip axis to ensure consistent direction away from the stationary object
-                smallestAxis = { -smallestAxis.x, -smallestAxis.y };
+    void Collision::System::detectAABBBatch(AABBBatch& batch, float delta_time, size_t begin, size_t end) {
+        // Lanes processed ( padding lanes hold stale data and are ignored by getAABBBatchResult )
+        size_t lanes = (Utility::getMin(end, batch.count) + 3) & ~static_cast<size_t>(3);
+
+#ifdef NIKE_COLLISION_SSE
+        const __m128 eps = _mm_set1_ps(EPSILON);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 dt = _mm_set1_ps(delta_time);
+        const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+        // Select a where mask is set, else b
+        auto select = [](__m128 mask, __m128 a, __m128 b) {
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+            };
+
+        for (size_t i = begin; i < lanes; i += 4) {
+            __m128 a_min_x = _mm_loadu_ps(&batch.a_min_x[i]);
+            __m128 a_min_y = _mm_loadu_ps(&batch.a_min_y[i]);
+            __m128 a_max_x = _mm_loadu_ps(&batch.a_max_x[i]);
+            __m128 a_max_y = _mm_loadu_ps(&batch.a_max_y[i]);
+            __m128 b_min_x = _mm_loadu_ps(&batch.b_min_x[i]);
+            __m128 b_min_y = _mm_loadu_ps(&batch.b_min_y[i]);
+            __m128 b_max_x = _mm_loadu_ps(&batch.b_max_x[i]);
+            __m128 b_max_y = _mm_loadu_ps(&batch.b_max_y[i]);
+            __m128 vel_x = _mm_loadu_ps(&batch.vel_x[i]);
+            __m128 vel_y = _mm_loadu_ps(&batch.vel_y[i]);
+
+            // Step 1: Static collision detection
+            __m128 sep_x = _mm_or_ps(_mm_cmplt_ps(a_max_x, b_min_x), _mm_cmpgt_ps(a_min_x, b_max_x));
+            __m128 sep_y = _mm_or_ps(_mm_cmplt_ps(a_max_y, b_min_y), _mm_cmpgt_ps(a_min_y, b_max_y));
+            __m128 static_hit = _mm_andnot_ps(_mm_or_ps(sep_x, sep_y), _mm_castsi128_ps(_mm_set1_epi32(-1)));
+
+            // Step 2: Dynamic collision detection along x-axis
+            __m128 move_x = _mm_cmpgt_ps(_mm_and_ps(vel_x, abs_mask), eps);
+            __m128 pos_x = _mm_cmpgt_ps(vel_x, zero);
+            __m128 lo_x = _mm_div_ps(_mm_sub_ps(a_min_x, b_max_x), vel_x);
+            __m128 hi_x = _mm_div_ps(_mm_sub_ps(a_max_x, b_min_x), vel_x);
+            __m128 t_first_x = select(move_x, select(pos_x, lo_x, hi_x), zero);
+            __m128 t_last_x = select(move_x, select(pos_x, hi_x, lo_x), dt);
+            __m128 reject_x = _mm_andnot_ps(move_x, sep_x);
+
+            // Dynamic collision detection along y-axis
+            __m128 move_y = _mm_cmpgt_ps(_mm_and_ps(vel_y, abs_mask), eps);
+            __m128 pos_y = _mm_cmpgt_ps(vel_y, zero);
+            __m128 lo_y = _mm_div_ps(_mm_sub_ps(a_min_y, b_max_y), vel_y);
+            __m128 hi_y = _mm_div_ps(_mm_sub_ps(a_max_y, b_min_y), vel_y);
+            __m128 t_first_y = select(move_y, select(pos_y, hi_y, lo_y), zero);
+            __m128 t_last_y = select(move_y, select(pos_y, lo_y, hi_y), dt);
+            __m128 reject_y = _mm_andnot_ps(move_y, sep_y);
+
+            // Verify if collisions occur within the time frame
+            __m128 t_first = _mm_max_ps(t_first_x, t_first_y);
+            __m128 t_last = _mm_min_ps(t_last_x, t_last_y);
+            __m128 miss = _mm_or_ps(_mm_or_ps(reject_x, reject_y), _mm_or_ps(_mm_cmpgt_ps(t_first, t_last), _mm_cmpgt_ps(t_first, dt)));
+
+            // Write results
+            int static_bits = _mm_movemask_ps(static_hit);
+            int miss_bits = _mm_movemask_ps(miss);
+            _mm_storeu_ps(&batch.t_first[i], t_first);
+            for (int lane = 0; lane < 4; ++lane) {
+                batch.hit[i + lane] = (static_bits >> lane) & 1 ? 1 : ((miss_bits >> lane) & 1 ? 0 : 2);
+            }
+        }
+#else
+        for (size_t i = begin; i < lanes; ++i) {
+
+            // Step 1: Static collision detection
+            bool sep_x = batch.a_max_x[i] < batch.b_min_x[i] || batch.a_min_x[i] > batch.b_max_x[i];
+            bool sep_y = batch.a_max_y[i] < batch.b_min_y[i] || batch.a_min_y[i] > batch.b_max_y[i];
+            if (!sep_x && !sep_y) {
+                batch.hit[i] = 1;
+                continue;
+            }
+
+            // Step 2: Dynamic collision detection
+            float vel_x = batch.vel_x[i];
+            float vel_y = batch.vel_y[i];
+            Vector2f t_first = { 0.0f, 0.0f };
+            Vector2f t_last = { delta_time, delta_time };
+            batch.hit[i] = 0;
+
+            // Check dynamic collision along x-axis
+            if (std::abs(vel_x) > EPSILON) {
+                float lo = (batch.a_min_x[i] - batch.b_max_x[i]) / vel_x;
+                float hi = (batch.a_max_x[i] - batch.b_min_x[i]) / vel_x;
+                t_first.x = vel_x > 0 ? lo : hi;
+                t_last.x = vel_x > 0 ? hi : lo;
+            }
+            else if (sep_x) {
+                continue;
             }
 
-            // Adjust MTV and normal
-            info.mtv = (smallestAxis * minOverlap) + (smallestAxis * biasFactor);
-            info.collision_normal = smallestAxis.normalize();
+            // Check dynamic collision along y-axis
+            if (std::abs(vel_y) > EPSILON) {
+                float lo = (batch.a_min_y[i] - batch.b_max_y[i]) / vel_y;
+                float hi = (batch.a_max_y[i] - batch.b_min_y[i]) / vel_y;
+                t_first.y = vel_y > 0 ? hi : lo;
+                t_last.y = vel_y > 0 ? lo : hi;
+            }
+            else if (sep_y) {
+                continue;
+            }
+
+            // Verify if collisions occur within the time frame
+            float t_first_overall = Utility::getMax(t_first.x, t_first.y);
+            float t_last_overall = Utility::getMin(t_last.x, t_last.y);
+            batch.t_first[i] = t_first_overall;
+            if (t_first_overall > t_last_overall || t_first_overall > delta_time) {
+                continue;
+            }
+
+            batch.hit[i] = 2;
+        }
+#endif
+    }
+
+    bool Collision::System::getAABBBatchResult(AABBBatch const& batch, size_t index, CollisionInfo& info) const {
+        if (index >= batch.count) return false;
+
+        // Static collision, compute MTV from smallest overlap
+        if (batch.hit[index] == 1) {
+            float overlapX = Utility::getMin(batch.a_max_x[index] - batch.b_min_x[index], batch.b_max_x[index] - batch.a_min_x[index]);
+            float overlapY = Utility::getMin(batch.a_max_y[index] - batch.b_min_y[index], batch.b_max_y[index] - batch.a_min_y[index]);
+
+            // Determine MTV direction and smallest overlap
+            Vector2f mtv_dir;
+            if (overlapX < overlapY) {
+                mtv_dir = { (batch.a_min_x[index] < batch.b_min_x[index] ? -1.0f : 1.0f), 0.0f };
+            }
+            else {
+                mtv_dir = { 0.0f, (batch.a_min_y[index] < batch.b_min_y[index] ? -1.0f : 1.0f) };
+            }
+
+            // Set MTV and collision normal
+            float overlap = overlapX < overlapY ? overlapX : overlapY;
+            info.mtv = { mtv_dir.x * overlap, mtv_dir.y * overlap };
+            info.collision_normal = mtv_dir;
+            info.t_first = 0.0f; // Static collision occurs
+            return true;
         }
 
-        return collisionDetected;
+        // Swept collision
+        if (batch.hit[index] == 2) {
+            Vector2f vel_rel = { batch.vel_x[index], batch.vel_y[index] };
+            info.t_first = batch.t_first[index];
+            info.collision_normal = vel_rel.normalize();
+            return true;
+        }
+
+        return false;
     }
 
     void Collision::System::applySlideCorrection(Physics::Dynamics& dynamics, const Vector2f& normal) {
@@ -492,6 +535,10 @@ namespace NIKE {
         processed_collisions.clear();
     }
 
+    bool Collision::System::shouldCollide(Entity::Type entity_a, Entity::Type entity_b) {
+        return healthDropCollisionCheck(entity_a, entity_b) && factionCollisionCheck(entity_a, entity_b);
+    }
+
     bool Collision::System::healthDropCollisionCheck(Entity::Type entity_a, Entity::Type entity_b) {
         // Check if entity_a or entity_b has a HealthDrop component
         const auto health_drop_a = NIKE_ECS_MANAGER->getEntityComponent<Combat::HealthDrop>(entity_a);
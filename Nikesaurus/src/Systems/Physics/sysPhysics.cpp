@@ -24,64 +24,99 @@ namespace NIKE {
 
         std::shared_ptr<Physics::Manager> physics_sys_wrapped(this, [](Physics::Manager*) {});
         NIKE_EVENTS_SERVICE->addEventListeners<Physics::ChangePhysicsEvent>(physics_sys_wrapped);
+        NIKE_EVENTS_SERVICE->addEventListeners<Coordinator::EntitiesChanged>(physics_sys_wrapped);
     }
 
     //------------------------------------------------------------------------
-    // calculateOccupiedCells()
-    //
-    // Determine which grid cells an entity occupies. Expand by 1 cell in each direction as a margin, to ensure proper checking.
+    // getColliderBounds()
     //------------------------------------------------------------------------
-    std::vector<Vector2i> Physics::Manager::calculateOccupiedCells(const Transform::Transform& transform) {
-        std::vector<Vector2i> occupied_cells;
-
-        // Compute entity's AABB
-        Vector2f half_size = transform.scale * 0.5f;
-        Vector2f world_min = transform.position - half_size;
-        Vector2f world_max = transform.position + half_size;
+    void Physics::Manager::getColliderBounds(const Physics::Collider& collider, Vector2f& bounds_min, Vector2f& bounds_max) const {
+        // Rotation aware half extents
+        float rad = collider.transform.rotation * static_cast<float>(M_PI) / 180.0f;
+        float cos_r = std::abs(std::cos(rad));
+        float sin_r = std::abs(std::sin(rad));
+        Vector2f half_size = {
+            (collider.transform.scale.x * cos_r + collider.transform.scale.y * sin_r) * 0.5f,
+            (collider.transform.scale.x * sin_r + collider.transform.scale.y * cos_r) * 0.5f
+        };
+
+        bounds_min = collider.transform.position - half_size;
+        bounds_max = collider.transform.position + half_size;
+    }
 
-        // Convert corners to cell indices
-        auto min_cell_opt = NIKE_MAP_SERVICE->getCellIndexFromCords(world_min);
-        auto max_cell_opt = NIKE_MAP_SERVICE->getCellIndexFromCords(world_max);
+    //------------------------------------------------------------------------
+    // syncCollider()
+    //------------------------------------------------------------------------
+    void Physics::Manager::syncCollider(Physics::Collider& collider, const Transform::Transform& transform) const {
+        // If bound to entity, copy transform
+        if (collider.b_bind_to_entity) {
+            collider.transform = transform;
+        }
+        else {
+            collider.transform.position = transform.position + collider.pos_offset;
+        }
+    }
 
-        // If out-of-bounds, or can't get cell indices, just return empty
-        if (!min_cell_opt || !max_cell_opt) {
-            return occupied_cells;
+    //------------------------------------------------------------------------
+    // updateBroadphaseProxy()
+    //
+    // Compute the collider's bounds, swept by its motion over dt, and update its
+    // broadphase proxy. Continuous bodies are not swept, their path is raycast
+    // separately in sweepContinuousBody().
+    //------------------------------------------------------------------------
+    void Physics::Manager::updateBroadphaseProxy(Entity::Type entity, const Physics::Collider& collider, const Physics::Dynamics* dynamics, Broadphase::Mobility mobility, float dt) {
+        Vector2f bounds_min, bounds_max;
+        getColliderBounds(collider, bounds_min, bounds_max);
+
+        // Sweep bounds by motion within the step
+        if (dynamics && mobility == Broadphase::Mobility::AWAKE && !collider.b_continuous) {
+            Vector2f sweep = dynamics->velocity * dt;
+            bounds_min.x += Utility::getMin(sweep.x, 0.0f);
+            bounds_min.y += Utility::getMin(sweep.y, 0.0f);
+            bounds_max.x += Utility::getMax(sweep.x, 0.0f);
+            bounds_max.y += Utility::getMax(sweep.y, 0.0f);
         }
 
-        Vector2i min_cell = min_cell_opt.value();
-        Vector2i max_cell = max_cell_opt.value();
+        broadphase.updateProxy(entity, bounds_min, bounds_max, mobility);
+    }
+
+    //------------------------------------------------------------------------
+    // getMobility()
+    //
+    // Static: no dynamics or zero max speed. Sleeping: still for SLEEP_STEPS
+    // steps. Sleeping bodies wake as soon as they gain velocity or force.
+    //------------------------------------------------------------------------
+    Broadphase::Mobility Physics::Manager::getMobility(Entity::Type entity, const Physics::Dynamics* dynamics) {
+        if (!dynamics || dynamics->max_speed <= 0.0f) {
+            return Broadphase::Mobility::STATIC;
+        }
 
-        // Expand by 1 cell each side
-        min_cell.x = Utility::getMax(0, min_cell.x - 1);
-        min_cell.y = Utility::getMax(0, min_cell.y - 1);
-        max_cell.x = Utility::getMin(NIKE_MAP_SERVICE->getGridSize().x - 1, max_cell.x + 1);
-        max_cell.y = Utility::getMin(NIKE_MAP_SERVICE->getGridSize().y - 1, max_cell.y + 1);
+        if (still_steps[entity] < SLEEP_STEPS) {
+            return Broadphase::Mobility::AWAKE;
+        }
 
-        // Fill all cells in range
-        for (int y = min_cell.y; y <= max_cell.y; ++y) {
-            for (int x = min_cell.x; x <= max_cell.x; ++x) {
-                occupied_cells.emplace_back(x, y);
-            }
+        // Wake sleeping body set in motion by gameplay
+        if (dynamics->velocity.length() >= EPSILON || dynamics->force.length() >= EPSILON) {
+            still_steps[entity] = 0;
+            return Broadphase::Mobility::AWAKE;
         }
 
-        return occupied_cells;
+        return Broadphase::Mobility::SLEEPING;
     }
 
     //------------------------------------------------------------------------
     // updateEntityPhysics()
     //
-    // Updates forces, velocity, transform, and the set of occupied cells.
+    // Updates forces, velocity, transform and the collider cache. Only touches
+    // the body's own components & per-entity slots, so bodies run in parallel.
     //------------------------------------------------------------------------
-    void Physics::Manager::updateEntityPhysics(Entity::Type entity, float dt) {
-        // Get transform
-        auto e_transform_comp = NIKE_ECS_MANAGER->getEntityComponent<Transform::Transform>(entity);
-        if (!e_transform_comp) return;
-        auto& e_transform = e_transform_comp.value().get();
+    void Physics::Manager::updateEntityPhysics(StepBody const& body, float dt) {
+        Entity::Type entity = body.entity;
+        auto& e_transform = *body.transform;
 
-        // Optionally get dynamics
-        auto e_dynamics_comp = NIKE_ECS_MANAGER->getEntityComponent<Physics::Dynamics>(entity);
-        if (e_dynamics_comp) {
-            auto& e_dynamics = e_dynamics_comp.value().get();
+        // Optionally update dynamics of awake bodies
+        if (body.dynamics && body.mobility == Broadphase::Mobility::AWAKE) {
+            auto& e_dynamics = *body.dynamics;
 
             // Ensure mass not negative
             e_dynamics.mass = (e_dynamics.mass == 0.0f) ? EPSILON : e_dynamics.mass;
@@ -108,195 +143,244 @@ namespace NIKE {
             // Update position
             e_transform.position.x += e_dynamics.velocity.x * dt;
             e_transform.position.y += e_dynamics.velocity.y * dt;
-        }
-
-        // Update collider transform and occupied cells
-        auto e_collider_comp = NIKE_ECS_MANAGER->getEntityComponent<Physics::Collider>(entity);
-        if (e_collider_comp) {
-            auto& e_collider = e_collider_comp.value().get();
 
-            // If bound to entity, copy transform
-            if (e_collider.b_bind_to_entity) {
-                e_collider.transform = e_transform;
+            // Track still steps for sleeping
+            if (e_dynamics.velocity.length() < EPSILON && e_dynamics.force.length() < EPSILON) {
+                still_steps[entity] = static_cast<uint16_t>(Utility::getMin<int>(still_steps[entity] + 1, SLEEP_STEPS));
             }
             else {
-                e_collider.transform.position = e_transform.position + e_collider.pos_offset;
+                still_steps[entity] = 0;
             }
+        }
+
+        // Update collider transform
+        if (body.collider) {
+            auto& e_collider = *body.collider;
+
+            // Sync to entity transform
+            syncCollider(e_collider, e_transform);
 
             // Reset collision flag
             e_collider.b_collided = false;
 
-            // Finally, record occupied cells
-            entity_occupied_cells[entity] = calculateOccupiedCells(e_collider.transform);
+            // Cache narrowphase data, collider stays put until its next update
+            collision_system->cacheCollider(e_collider, *body.model_id, collider_cache[entity]);
         }
     }
 
     //------------------------------------------------------------------------
-    // getPotentialCollisions()
+    // sweepContinuousBody()
     //
-    // 1) Build collision pairs from shared cells
-    // 2) Hard-coded hack: if entity name is "left_wall", "right_wall", etc.,
-    //    forcibly collide with *all* other colliders. (TODO, optimise)
+    // Raycast the body's box from its start-of-step position against nearby
+    // proxies ( slab test against bounds expanded by the body's half extents,
+    // in motion relative to the other body ). On a hit the body is moved back
+    // to the time of impact and a swept contact is queued for resolution.
     //------------------------------------------------------------------------
-    std::vector<std::pair<Entity::Type, Entity::Type>> Physics::Manager::getPotentialCollisions() {
-        std::vector<std::pair<Entity::Type, Entity::Type>> pairs;
-        std::set<std::pair<Entity::Type, Entity::Type>> processed_pairs;
-
-        // (A) Normal broad-phase from overlapping cells
-        for (const auto& [entity, cells] : entity_occupied_cells) {
-            // For each cell occupied by this entity, gather any other entity that shares it
-            std::unordered_map<Vector2i, std::vector<Entity::Type>, Vector2iHasher> cell_map;
-
-            for (auto& cell_pos : cells) {
-                for (auto& [other_entity, other_cells] : entity_occupied_cells) {
-                    if (entity == other_entity) continue;
-                    // If other occupies the same cell
-                    if (std::find(other_cells.begin(), other_cells.end(), cell_pos) != other_cells.end()) {
-                        cell_map[cell_pos].push_back(other_entity);
-                    }
+    void Physics::Manager::sweepContinuousBody(StepBody const& body, float dt) {
+        auto& e_collider = *body.collider;
+        Vector2f delta = body.transform->position - body.start_position;
+        if (delta.length() < EPSILON) return;
+
+        // Body box at the start of the step
+        Vector2f bounds_min, bounds_max;
+        getColliderBounds(e_collider, bounds_min, bounds_max);
+        Vector2f half_extent = (bounds_max - bounds_min) * 0.5f;
+        Vector2f end = e_collider.transform.position;
+        Vector2f start = end - delta;
+
+        // Gather candidates along path
+        broadphase.querySegment(start, end, half_extent, ccd_candidates);
+
+        auto collider_view = NIKE_ECS_MANAGER->view<Physics::Collider>();
+        auto dynamics_view = NIKE_ECS_MANAGER->view<Physics::Dynamics>();
+
+        float t_hit = 1.0f;
+        Entity::Type hit_entity = body.entity;
+        Vector2f hit_motion;
+        for (auto other : ccd_candidates) {
+            if (other == body.entity) continue;
+
+            auto* other_collider = collider_view.tryGet<Physics::Collider>(other);
+            if (!other_collider) continue;
+            if (!collision_system->shouldCollide(body.entity, other)) continue;
+
+            // Other body's motion within the step
+            auto* other_dynamics = dynamics_view.tryGet<Physics::Dynamics>(other);
+            Vector2f other_delta = (other_dynamics && other_dynamics->max_speed > 0.0f) ? other_dynamics->velocity * dt : Vector2f();
+            Vector2f motion = delta - other_delta;
+
+            // Other box at the start of the step, expanded by body's half extents
+            Vector2f other_min, other_max;
+            getColliderBounds(*other_collider, other_min, other_max);
+            other_min = other_min - other_delta - half_extent;
+            other_max = other_max - other_delta + half_extent;
+
+            // Already overlapping at start, left to discrete narrowphase
+            if (start.x >= other_min.x && start.x <= other_max.x && start.y >= other_min.y && start.y <= other_max.y) continue;
+
+            // Slab test
+            float t_enter = 0.0f;
+            float t_exit = t_hit;
+            bool b_miss = false;
+            for (int axis = 0; axis < 2 && !b_miss; ++axis) {
+                float origin = axis == 0 ? start.x : start.y;
+                float dir = axis == 0 ? motion.x : motion.y;
+                float slab_min = axis == 0 ? other_min.x : other_min.y;
+                float slab_max = axis == 0 ? other_max.x : other_max.y;
+
+                if (std::abs(dir) < EPSILON) {
+                    b_miss = origin < slab_min || origin > slab_max;
+                    continue;
                 }
-            }
 
-            // Generate unique pairs from those cell matches
-            for (auto& [cell_pos, occupant_list] : cell_map) {
-                for (Entity::Type other_entity : occupant_list) {
-                    // Sort pair so smaller ID is first
-                    auto pair = Utility::getMinMax(entity, other_entity);
-                    if (processed_pairs.insert(pair).second) {
-                        pairs.push_back(pair);
-                    }
-                }
-            }
-        }
+                float t_near = (slab_min - origin) / dir;
+                float t_far = (slab_max - origin) / dir;
+                if (t_near > t_far) std::swap(t_near, t_far);
 
-        // (B) Hard-coded "wall" collisions: forcibly pair any entity that is very large.
-        auto isVeryLarge = [&](Entity::Type e) -> bool {
-            // Attempt to get the Transform::Transform component
-            auto transform_opt = NIKE_ECS_MANAGER->getEntityComponent<Transform::Transform>(e);
-            if (!transform_opt) {
-                return false; // No transform => definitely not "large"
+                t_enter = Utility::getMax(t_enter, t_near);
+                t_exit = Utility::getMin(t_exit, t_far);
+                b_miss = t_enter > t_exit;
             }
 
-            // Check scale
-            auto& transform = transform_opt.value().get();
-            float width = transform.scale.x;
-            float height = transform.scale.y;
-
-            // If bigger than 1000 in either dimension, treat as a "wall"
-            return (width >= 1000.0f || height >= 1000.0f);  // (Temporarily forced more)
-            };
-
-        // Collect "large" entities and all other colliders
-        std::vector<Entity::Type> large_entities;
-        std::vector<Entity::Type> all_colliders;
-
-        for (auto& [ent, occupiedCells] : entity_occupied_cells) {
-            auto col_opt = NIKE_ECS_MANAGER->getEntityComponent<Physics::Collider>(ent);
-            if (!col_opt.has_value()) {
-                continue; // skip if no collider
-            }
+            if (b_miss || t_enter >= t_hit) continue;
 
-            if (isVeryLarge(ent)) {
-                large_entities.push_back(ent);
-            }
-            else {
-                all_colliders.push_back(ent);
-            }
+            t_hit = t_enter;
+            hit_entity = other;
+            hit_motion = motion;
         }
 
-        // For each large entity, forcibly pair it with all other colliders
-        for (auto large_ent : large_entities) {
-            for (auto c : all_colliders) {
-                if (large_ent == c) continue;
-                auto pair = Utility::getMinMax(large_ent, c);
-                if (processed_pairs.insert(pair).second) {
-                    pairs.push_back(pair);
-                }
-            }
-        }
+        if (hit_entity == body.entity) return;
+
+        // Move body back to time of impact
+        body.transform->position = body.start_position + delta * t_hit;
+        syncCollider(e_collider, *body.transform);
+        collision_system->cacheCollider(e_collider, *body.model_id, collider_cache[body.entity]);
+        updateBroadphaseProxy(body.entity, e_collider, body.dynamics, body.mobility, dt);
 
-        return pairs;
+        // Queue swept contact
+        CCDContact contact{ body.entity, hit_entity, Collision::CollisionInfo() };
+        contact.info.t_first = t_hit * dt;
+        contact.info.collision_normal = hit_motion.normalized();
+        ccd_contacts.push_back(contact);
     }
 
     //------------------------------------------------------------------------
     // processCollisions()
     //
-    // For each potential pair, do final collision detection (AABB, SAT).
+    // Gather every potential pair into the AABB batch, test pairs in parallel
+    // ( falling back to SAT for rotated colliders ), then resolve in order.
     //------------------------------------------------------------------------
-    void Physics::Manager::processCollisions(const std::vector<std::pair<Entity::Type, Entity::Type>>& collision_pairs) {
+    void Physics::Manager::processCollisions(const std::vector<std::pair<Entity::Type, Entity::Type>>& collision_pairs, float dt) {
+        // Views of collision components
+        auto collider_view = NIKE_ECS_MANAGER->view<Transform::Transform, Physics::Collider>();
+        auto dynamics_view = NIKE_ECS_MANAGER->view<Physics::Dynamics>();
+
+        // (A) Batch static & swept AABB tests
+        aabb_batch.clear();
         for (auto& [entity_a, entity_b] : collision_pairs) {
-            // Grab components
-            auto a_transform_comp = NIKE_ECS_MANAGER->getEntityComponent<Transform::Transform>(entity_a);
-            auto a_collider_comp = NIKE_ECS_MANAGER->getEntityComponent<Physics::Collider>(entity_a);
-            auto a_dynamics_comp = NIKE_ECS_MANAGER->getEntityComponent<Physics::Dynamics>(entity_a);
+            auto* a_dynamics = dynamics_view.tryGet<Physics::Dynamics>(entity_a);
+            auto* b_dynamics = dynamics_view.tryGet<Physics::Dynamics>(entity_b);
 
-            auto b_transform_comp = NIKE_ECS_MANAGER->getEntityComponent<Transform::Transform>(entity_b);
-            auto b_collider_comp = NIKE_ECS_MANAGER->getEntityComponent<Physics::Collider>(entity_b);
-            auto b_dynamics_comp = NIKE_ECS_MANAGER->getEntityComponent<Physics::Dynamics>(entity_b);
+            aabb_batch.push(collider_cache[entity_a], a_dynamics ? a_dynamics->velocity : Vector2f(),
+                collider_cache[entity_b], b_dynamics ? b_dynamics->velocity : Vector2f());
+        }
 
-            if (!a_transform_comp.has_value() || !a_collider_comp.has_value() ||
-                !b_transform_comp.has_value() || !b_collider_comp.has_value()) {
+        // (B) Narrowphase across workers, AABB result with SAT fallback unless both rotations are multiples of 90
+        contacts.assign(collision_pairs.size(), Contact());
+        NIKE_JOBS_SERVICE->parallelFor(collision_pairs.size(), PAIR_GRAIN, [&](size_t begin, size_t end) {
+            collision_system->detectAABBBatch(aabb_batch, dt, begin, end);
+
+            for (size_t i = begin; i < end; ++i) {
+                auto [entity_a, entity_b] = collision_pairs[i];
+                auto& contact = contacts[i];
+
+                contact.b_detected = collision_system->getAABBBatchResult(aabb_batch, i, contact.info);
+
+                auto const& a_cache = collider_cache[entity_a];
+                auto const& b_cache = collider_cache[entity_b];
+                if (!contact.b_detected && !(a_cache.b_axis_aligned && b_cache.b_axis_aligned)) {
+                    auto* a_collider = collider_view.tryGet<Physics::Collider>(entity_a);
+                    auto* b_collider = collider_view.tryGet<Physics::Collider>(entity_b);
+                    if (!a_collider || !b_collider) continue;
+
+                    contact.b_detected = collision_system->detectSATCollision(
+                        a_cache, a_collider->transform.position, b_cache, b_collider->transform.position, contact.info);
+                }
+            }
+            });
+
+        // (C) Resolve time of impact contacts of continuous bodies first
+        for (auto const& contact : ccd_contacts) {
+            if (!collider_view.contains(contact.entity_a) || !collider_view.contains(contact.entity_b)) {
                 continue;
             }
 
-            // Refs
-            auto& a_transform = a_transform_comp.value().get();
-            auto& a_collider = a_collider_comp.value().get();
+            auto [a_transform, a_collider] = collider_view.get(contact.entity_a);
+            auto [b_transform, b_collider] = collider_view.get(contact.entity_b);
 
             Physics::Dynamics def_dynA;
-            auto& a_dynamics = a_dynamics_comp.has_value() ? a_dynamics_comp.value().get() : def_dynA;
-
-            auto& b_transform = b_transform_comp.value().get();
-            auto& b_collider = b_collider_comp.value().get();
+            auto* a_dynamics_ptr = dynamics_view.tryGet<Physics::Dynamics>(contact.entity_a);
+            auto& a_dynamics = a_dynamics_ptr ? *a_dynamics_ptr : def_dynA;
 
             Physics::Dynamics def_dynB;
-            auto& b_dynamics = b_dynamics_comp.has_value() ? b_dynamics_comp.value().get() : def_dynB;
-
-            // For shape-based collisions (SAT)
-            std::string a_model_id = "square.model";
-            std::string b_model_id = "square.model";
-            auto a_shape_comp = NIKE_ECS_MANAGER->getEntityComponent<Render::Shape>(entity_a);
-            if (a_shape_comp.has_value()) {
-                a_model_id = a_shape_comp.value().get().model_id;
-            }
-            auto b_shape_comp = NIKE_ECS_MANAGER->getEntityComponent<Render::Shape>(entity_b);
-            if (b_shape_comp.has_value()) {
-                b_model_id = b_shape_comp.value().get().model_id;
-            }
+            auto* b_dynamics_ptr = dynamics_view.tryGet<Physics::Dynamics>(contact.entity_b);
+            auto& b_dynamics = b_dynamics_ptr ? *b_dynamics_ptr : def_dynB;
+
+            a_collider.b_collided = true;
+            b_collider.b_collided = true;
+
+            // Wake bodies involved in collision
+            still_steps[contact.entity_a] = 0;
+            still_steps[contact.entity_b] = 0;
+
+            collision_system->collisionResolution(
+                contact.entity_a, a_transform, a_dynamics, a_collider,
+                contact.entity_b, b_transform, b_dynamics, b_collider,
+                contact.info
+            );
+        }
+
+        // (D) Resolve collisions in sorted pair order
+        for (size_t i = 0; i < collision_pairs.size(); ++i) {
+            auto [entity_a, entity_b] = collision_pairs[i];
 
             // Record how many collision checks we do, just for logging
             collision_checks_count[entity_a]++;
             collision_checks_count[entity_b]++;
 
-            // AABB vs. SAT
-            Collision::CollisionInfo info;
-            bool collision_detected = false;
-
-            // If both rotations are multiples of 90, do simpler AABB
-            if (!(static_cast<int>(a_collider.transform.rotation) % 90) &&
-                !(static_cast<int>(b_collider.transform.rotation) % 90)) {
-                collision_detected = collision_system->detectAABBRectRect(
-                    a_dynamics, a_collider, b_dynamics, b_collider, info);
+            if (!contacts[i].b_detected) {
+                continue;
             }
-            // Otherwise, check AABB or fallback to SAT
-            else {
-                collision_detected = collision_system->detectAABBRectRect(
-                    a_dynamics, a_collider, b_dynamics, b_collider, info)
-                    || collision_system->detectSATCollision(
-                        a_collider, b_collider, a_model_id, b_model_id, info);
+
+            if (!collider_view.contains(entity_a) || !collider_view.contains(entity_b)) {
+                continue;
             }
 
-            // If collided, do resolution
-            if (collision_detected) {
-                a_collider.b_collided = true;
-                b_collider.b_collided = true;
+            // Refs
+            auto [a_transform, a_collider] = collider_view.get(entity_a);
+            auto [b_transform, b_collider] = collider_view.get(entity_b);
 
-                collision_system->collisionResolution(
-                    entity_a, a_transform, a_dynamics, a_collider,
-                    entity_b, b_transform, b_dynamics, b_collider,
-                    info
-                );
-            }
+            Physics::Dynamics def_dynA;
+            auto* a_dynamics_ptr = dynamics_view.tryGet<Physics::Dynamics>(entity_a);
+            auto& a_dynamics = a_dynamics_ptr ? *a_dynamics_ptr : def_dynA;
+
+            Physics::Dynamics def_dynB;
+            auto* b_dynamics_ptr = dynamics_view.tryGet<Physics::Dynamics>(entity_b);
+            auto& b_dynamics = b_dynamics_ptr ? *b_dynamics_ptr : def_dynB;
+
+            // Collided, do resolution
+            a_collider.b_collided = true;
+            b_collider.b_collided = true;
+
+            // Wake bodies involved in collision
+            still_steps[entity_a] = 0;
+            still_steps[entity_b] = 0;
+
+            collision_system->collisionResolution(
+                entity_a, a_transform, a_dynamics, a_collider,
+                entity_b, b_transform, b_dynamics, b_collider,
+                contacts[i].info
+            );
         }
     }
 
@@ -304,44 +388,94 @@ namespace NIKE {
     // Physics::Manager::update()
     //
     // 1) Clear collisions
-    // 2) Per-step: update physics, build potential pairs, process collisions
+    // 2) Per-step: integrate in parallel, update broadphase, build potential pairs,
+    //    test pairs in parallel & resolve collisions in order
     //------------------------------------------------------------------------
     void Physics::Manager::update() {
         // Clear any collisions from last frame
         collision_system->clearProcessedCollisions();
 
         // Clear old mappings
-        entity_occupied_cells.clear();
         collision_checks_count.clear();
 
+        // Match broadphase cells to map cells
+        broadphase.setCellSize(NIKE_MAP_SERVICE->getCellSize());
+
         // Get dt
         float dt = NIKE_WINDOWS_SERVICE->getFixedDeltaTime();
 
-        // Grab layers
-        auto const& layers = NIKE_SCENES_SERVICE->getLayers();
+        // Skip entities of inactive layers
+        NIKE_SCENES_SERVICE->markInactiveLayerEntities(b_inactive_entities);
 
         // Up to 5 steps
         constexpr int MAX_PHYSICS_STEPS = 5;
         int steps = Utility::getMin(NIKE_WINDOWS_SERVICE->getCurrentNumOfSteps(), MAX_PHYSICS_STEPS);
 
+        // Views of physics bodies ( each driven by the smallest of its pools )
+        auto collider_body_view = NIKE_ECS_MANAGER->view<Transform::Transform, Physics::Collider>();
+        auto dynamics_body_view = NIKE_ECS_MANAGER->view<Transform::Transform, Physics::Dynamics>();
+        auto body_view = NIKE_ECS_MANAGER->view<Transform::Transform, Physics::Dynamics, Physics::Collider>();
+        auto shape_view = NIKE_ECS_MANAGER->view<Render::Shape>();
+        static const std::string default_model_id = "square.model";
+
         // For each step
         for (int s = 0; s < steps; ++s) {
 
-            // (A) Update physics on all relevant entities
-            for (auto& layer : layers) {
-                if (!layer->getLayerState()) continue; // skip inactive
+            // (A) Gather bodies with a collider or dynamics ( static & sleeping bodies only on the first step )
+            step_bodies.clear();
+            auto gatherBody = [&](Entity::Type entity, Transform::Transform& e_transform) {
+                if (b_inactive_entities[entity]) return;
+
+                auto* e_dynamics = body_view.tryGet<Physics::Dynamics>(entity);
+                auto mobility = getMobility(entity, e_dynamics);
+                if (s > 0 && mobility != Broadphase::Mobility::AWAKE) return;
+
+                auto* e_shape = shape_view.tryGet<Render::Shape>(entity);
+                step_bodies.push_back({ entity, &e_transform,
+                    e_dynamics, body_view.tryGet<Physics::Collider>(entity),
+                    e_shape ? &e_shape->model_id.getString() : &default_model_id, mobility, e_transform.position });
+                };
+            for ([[maybe_unused]] auto [entity, e_transform, e_collider] : collider_body_view) {
+                gatherBody(entity, e_transform);
+            }
+            for ([[maybe_unused]] auto [entity, e_transform, e_dynamics] : dynamics_body_view) {
+                if (collider_body_view.contains(entity)) continue; // gathered with colliders
+                gatherBody(entity, e_transform);
+            }
 
-                for (auto& entity : layer->getEntitites()) {
-                    if (entities.find(entity) == entities.end()) continue;
-                    updateEntityPhysics(entity, dt);
+            // Integrate bodies across workers
+            NIKE_JOBS_SERVICE->parallelFor(step_bodies.size(), BODY_GRAIN, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    updateEntityPhysics(step_bodies[i], dt);
                 }
+                });
+
+            // Update broadphase proxies & prune proxies of entities no longer simulated
+            if (s == 0) broadphase.beginFrame();
+            for (auto const& body : step_bodies) {
+                if (!body.collider) continue;
+                updateBroadphaseProxy(body.entity, *body.collider, body.dynamics, body.mobility, dt);
+            }
+            if (s == 0) broadphase.endFrame();
+
+            // Wake sleeping bodies under static colliders that spawned or moved
+            broadphase.wakeSleeping(woken_entities);
+            for (auto entity : woken_entities) {
+                still_steps[entity] = 0;
+            }
+
+            // Sweep continuous bodies against the updated broadphase
+            ccd_contacts.clear();
+            for (auto const& body : step_bodies) {
+                if (!body.collider || !body.collider->b_continuous || body.mobility != Broadphase::Mobility::AWAKE) continue;
+                sweepContinuousBody(body, dt);
             }
 
             // (B) Build potential collision pairs
-            auto collision_pairs = getPotentialCollisions();
+            broadphase.queryPairs(potential_pairs);
 
             // (C) Process collisions
-            processCollisions(collision_pairs);
+            processCollisions(potential_pairs, dt);
 
             // (D) Logging how many checks each entity did
             /*for (auto& [ent, checks] : collision_checks_count) {
@@ -357,4 +491,14 @@ namespace NIKE {
         collision_system->setRestitution(event->restitution);
         event->setEventProcessed(true);
     }
+
+    //------------------------------------------------------------------------
+    // Physics::Manager::onEvent(EntitiesChanged)
+    //------------------------------------------------------------------------
+    void Physics::Manager::onEvent(std::shared_ptr<Coordinator::EntitiesChanged> event) {
+        // Clear sleep state of destroyed entities so recycled IDs start awake
+        for (auto entity : event->removed) {
+            still_steps[entity] = 0;
+        }
+    }
 } // namespace NIKE
@@ -31,7 +31,39 @@ namespace NIKE {
 		//GL enable opacity blending option
 		glEnable(GL_BLEND);
 		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	}
+
+	void Render::Manager::updateCullView() {
+
+		//Map NDC corners back into world space
+		Matrix_33 ndc_to_world;
+		Matrix_33Inverse(ndc_to_world, NIKE_CAMERA_SERVICE->getWorldToNDCXform());
+		view_min = ndc_to_world * Vector2f(-1.0f, -1.0f);
+		view_max = view_min;
+		for (auto const& corner : { Vector2f(1.0f, -1.0f), Vector2f(-1.0f, 1.0f), Vector2f(1.0f, 1.0f) }) {
+			Vector2f world_corner = ndc_to_world * corner;
+			view_min = { Utility::getMin(view_min.x, world_corner.x), Utility::getMin(view_min.y, world_corner.y) };
+			view_max = { Utility::getMax(view_max.x, world_corner.x), Utility::getMax(view_max.y, world_corner.y) };
+		}
+	}
+
+	bool Render::Manager::isCulled(Entity::Type entity) const {
+
+		//Entities without transform are never culled
+		auto const* e_transform = NIKE_ECS_MANAGER->tryGetEntityComponent<Transform::Transform>(entity);
+		if (!e_transform) return false;
+
+		//Screen space entities are always visible
+		if (e_transform->use_screen_pos) return false;
+
+		//Text & particles draw beyond their transform, never culled
+		if (NIKE_ECS_MANAGER->checkEntityComponent<Render::Text>(entity) || NIKE_ECS_MANAGER->checkEntityComponent<Render::ParticleEmitter>(entity)) return false;
 
+		//Half diagonal covers any rotation and texture aspect refit
+		const float half_extent = e_transform->scale.length() * 0.5f + CULL_MARGIN;
+		Vector2f const& position = e_transform->position;
+		return position.x + half_extent < view_min.x || position.x - half_extent > view_max.x ||
+			position.y + half_extent < view_min.y || position.y - half_extent > view_max.y;
 	}
 
 	void Render::Manager::update() {
@@ -51,6 +83,11 @@ namespace NIKE {
 		glClearColor(0, 0, 0, 1);
 		glClear(GL_COLOR_BUFFER_BIT);
 
+		//Cull world space entities outside camera view
+		updateCullView();
+		int visible_count = 0;
+		int culled_count = 0;
+
 		for (auto& layer : NIKE_SCENES_SERVICE->getLayers()) {
 
 			//SKip inactive layer
@@ -94,23 +131,21 @@ namespace NIKE {
 							}
 
 							Entity::Type player_entity = opt_player_entity.value();
-							auto player_comps = NIKE_ECS_MANAGER->getAllEntityComponents(player_entity);
-							auto player_transform_comp = player_comps.find(Utility::convertTypeString(typeid(Transform::Transform).name()));
-							if (player_transform_comp == player_comps.end()) {
+							auto const* player_transform = NIKE_ECS_MANAGER->tryGetEntityComponent<Transform::Transform>(player_entity);
+							if (!player_transform) {
 								NIKEE_CORE_ERROR("Player missing Transform");
 								return std::nullopt;
 							}
-							const Vector2f player_pos = std::static_pointer_cast<Transform::Transform>(player_transform_comp->second)->position;
+							const Vector2f player_pos = player_transform->position;
 
 							if (!parent_entity.has_value()) return std::nullopt;
 
-							auto parent_comps = NIKE_ECS_MANAGER->getAllEntityComponents(parent_entity.value());
-							auto parent_transform_comp = parent_comps.find(Utility::convertTypeString(typeid(Transform::Transform).name()));
-							if (parent_transform_comp == parent_comps.end()) {
+							auto const* parent_transform = NIKE_ECS_MANAGER->tryGetEntityComponent<Transform::Transform>(parent_entity.value());
+							if (!parent_transform) {
 								NIKEE_CORE_ERROR("Parent missing Transform");
 								return std::nullopt;
 							}
-							const Vector2f parent_pos = std::static_pointer_cast<Transform::Transform>(parent_transform_comp->second)->position;
+							const Vector2f parent_pos = parent_transform->position;
 
 							Vector2f dir = player_pos - parent_pos;
 							float angle_rad = std::atan2(dir.y, dir.x); // Angle in radians
@@ -134,16 +169,11 @@ namespace NIKE {
 							const float angle_deg = (gun_data->second * 180.f / (float)M_PI) + 90.f;
 							c_transform.rotation = angle_deg;
 
-							// Get gun components
-							auto gun_comps = NIKE_ECS_MANAGER->getAllEntityComponents(child_entity);
-
-							auto sprite_comp_it = gun_comps.find(Utility::convertTypeString(typeid(Animation::Sprite).name()));
-							if (sprite_comp_it != gun_comps.end()) {
-								Animation::Sprite& gun_sprite = *std::static_pointer_cast<Animation::Sprite>(sprite_comp_it->second);
-
-								gun_sprite.start_index.y = 0;
-								gun_sprite.end_index.y = 0;
-
+							// Get gun sprite
+							auto* gun_sprite = NIKE_ECS_MANAGER->tryGetEntityComponent<Animation::Sprite>(child_entity);
+							if (gun_sprite) {
+								gun_sprite->start_index.y = 0;
+								gun_sprite->end_index.y = 0;
 							}
 						}
 					}
@@ -170,14 +200,22 @@ namespace NIKE {
 					}
 				}
 
+				//Skip entity outside camera view
+				if (isCulled(entity)) {
+					++culled_count;
+				}
+				else {
+					++visible_count;
+
 #ifndef NDEBUG
-				//Render call for all entity
-				NIKE_RENDER_SERVICE->renderComponents(NIKE_ECS_MANAGER->getAllEntityComponents(entity), NIKE_LVLEDITOR_SERVICE->getDebugState());
+					//Render call for all entity
+					NIKE_RENDER_SERVICE->renderEntity(entity, NIKE_LVLEDITOR_SERVICE->getDebugState());
 #endif
 #ifdef NDEBUG
-				//Render call for all entity
-				NIKE_RENDER_SERVICE->renderComponents(NIKE_ECS_MANAGER->getAllEntityComponents(entity), false);
+					//Render call for all entity
+					NIKE_RENDER_SERVICE->renderEntity(entity, false);
 #endif
+				}
 
 				//Update old child position offset
 				if (child_pos_offset.has_value()) {
@@ -194,6 +232,9 @@ namespace NIKE {
 			}
 		}
 
+		//Report culling
+		NIKE_DEBUG_SERVICE->updateRenderCulling(visible_count, culled_count);
+
 		//Render custom cursor
 		NIKE_RENDER_SERVICE->renderCursor(NIKE_INPUT_SERVICE->getCrosshair(), NIKE_INPUT_SERVICE->getCursorEntererd());
 
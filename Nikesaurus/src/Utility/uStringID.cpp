@@ -0,0 +1,76 @@
+/*****************************************************************//**
+ * \file   uStringID.cpp
+ * \brief  Interned string IDs
+ *
+ * \author agent, agent@local (100%)
+ * \date   October 2026
+ * All content © 2026 DigiPen Institute of Technology Singapore, all rights reserved.
+ *********************************************************************/
+
+#include "Core/stdafx.h"
+#include "Utility/uStringID.h"
+
+namespace NIKE {
+
+	namespace {
+		//Global string table ( Node based map, references stay valid after insertion )
+		struct StringTable {
+			std::unordered_map<Utility::StringID, std::string> strings;
+			std::mutex mtx;
+		};
+
+		StringTable& getStringTable() {
+			static StringTable table;
+			return table;
+		}
+	}
+
+	Utility::StringID Utility::internString(std::string_view str) {
+		StringID id = hashString(str);
+
+		auto& table = getStringTable();
+		std::lock_guard<std::mutex> lock(table.mtx);
+
+		//Insert string or check existing string for collision
+		auto it = table.strings.find(id);
+		if (it == table.strings.end()) {
+			table.strings.emplace(id, std::string(str));
+		}
+		else if (it->second != str) {
+			throw std::runtime_error("String ID collision between \"" + it->second + "\" and \"" + std::string(str) + "\".");
+		}
+
+		return id;
+	}
+
+	std::string const& Utility::getInternedString(StringID id) {
+		auto& table = getStringTable();
+		std::lock_guard<std::mutex> lock(table.mtx);
+
+		auto it = table.strings.find(id);
+		if (it == table.strings.end()) {
+			throw std::runtime_error("String ID not interned.");
+		}
+
+		return it->second;
+	}
+
+	bool Utility::isStringInterned(StringID id) {
+		auto& table = getStringTable();
+		std::lock_guard<std::mutex> lock(table.mtx);
+
+		return table.strings.find(id) != table.strings.end();
+	}
+
+	Utility::InternedString& Utility::InternedString::operator=(std::string const& other) {
+		id = internString(other);
+		str = other;
+		return *this;
+	}
+
+	Utility::InternedString& Utility::InternedString::operator=(const char* other) {
+		id = internString(other);
+		str = other;
+		return *this;
+	}
+}
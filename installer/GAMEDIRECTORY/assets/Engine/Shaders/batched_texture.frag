@@ -15,13 +15,18 @@ layout (location=5) flat in float f_blend_intensity;
 
 layout (location=0) out	vec4 out_color;
 
-uniform sampler2D u_tex2d[32];	// 32 because that is the MAX_INSTANCES for rendering textures
+uniform sampler2D u_tex2d[31];	// standalone textures, MAX_UNIQUE_TEX_HDLS in render service
+uniform sampler2DArray u_atlas;	// runtime texture atlas, bound after the standalone textures
 //uniform sampler2D u_tex2d;
 
+const int ATLAS_SAMPLER_BASE = 31;	// sampler indices from here select an atlas layer
+
 void main() {
 	int idx = int(f_sampler_idx);
 
-	vec4 tex_color = texture(u_tex2d[idx], f_texcoord);		// layer is specified with f_sampler_idx for sampler2DArray u_tex2d
+	vec4 tex_color = idx >= ATLAS_SAMPLER_BASE
+		? texture(u_atlas, vec3(f_texcoord, float(idx - ATLAS_SAMPLER_BASE)))
+		: texture(u_tex2d[idx], f_texcoord);
 	//vec4 tex_color = texture(u_tex2d, f_texcoord);
 	//tex_color = texture(u_tex2d, vec2(0.5,0.5));
 